@@ -3,6 +3,7 @@
 #include <iomanip>
 #include <date-rfc/rfc-1123.h>
 #include <date-rfc/rfc-3339.h>
+#include <date-rfc/http-date.h>
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -100,11 +101,36 @@ void check_rfc3339()
     std::cout << std::endl;
 }
 
+// ----------------------------------------------------------------------------
+void check_http_date()
+{
+    const std::string values[] = {
+        std::string("Sun, 06 Nov 1994 08:49:37 GMT"),
+        std::string("Sunday, 06-Nov-94 08:49:37 GMT"),
+        std::string("Sun Nov  6 08:49:37 1994"),
+    };
+
+    std::cout << "-----------------------------------------" << std::endl;
+    std::cout << "#               HTTP-date               #" << std::endl;
+    for (auto value : values) {
+        std::time_t dt{};
+        std::istringstream stream(value);
+        stream >> date::format_http_date(dt);
+        std::cout << "-----------------------------------------" << std::endl;
+        std::cout << "Value:  " << value << std::endl;
+        std::cout << "Parsed: " << std::put_time(std::gmtime(&dt), "%c") 
+            << " (failbit: " << (stream.fail() ? "true" : "false") << ")" << std::endl;
+        std::cout << "Revert: " << date::format_http_date(dt) << std::endl;
+    }
+    std::cout << std::endl;
+}
+
 // ----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
     check_rfc1123();
     check_rfc3339();
+    check_http_date();
     return 0;
 }
 
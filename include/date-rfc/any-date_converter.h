@@ -0,0 +1,64 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <ctime>
+#include "date_converter.h"
+#include "rfc-1123_converter.h"
+#include "rfc-3339_converter.h"
+#include "any-date_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+template <>
+struct date_converter<any_date, std::time_t, void>
+{
+    static bool from_parts(const any_date::parts& parts, std::time_t& timepoint)
+    {
+        switch (parts.format)
+        {
+        case any_date::rfc1123_format:
+            return date_converter<rfc1123, std::time_t>::from_parts(parts.rfc1123_value, timepoint);
+        case any_date::rfc3339_format:
+            return date_converter<rfc3339, std::time_t>::from_parts(parts.rfc3339_value, timepoint);
+        case any_date::epoch_format:
+            timepoint = static_cast<std::time_t>(parts.epoch_seconds);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    //! Dates are written as RFC 3339.
+    static bool to_parts(std::time_t timepoint, any_date::parts& parts)
+    {
+        parts.format = any_date::rfc3339_format;
+        return date_converter<rfc3339, std::time_t>::to_parts(timepoint, parts.rfc3339_value);
+    }
+};
+
+} // namespace date
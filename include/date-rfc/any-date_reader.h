@@ -0,0 +1,125 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+#include "details/validation_policy.h"
+#include "any-date_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                              any date reader
+// ----------------------------------------------------------------------------
+//! Sticky mode of any_date: the format of the last value is remembered and
+//  the next value of the same source is read in that format without
+//  classification. When a value does not match the source is classified
+//  again: forward iterators are rewound for it, input iterators can not be
+//  rewound, so the value fails and the next one is classified.
+template <class Policy = strict_validation>
+class any_date_reader
+{
+public:
+    using format_type = any_date::format_type;
+    using parts = any_date::parts;
+
+    any_date_reader() = default;
+
+    explicit any_date_reader(format_type format)
+        : m_format(format)
+    {}
+
+    format_type format() const
+    {
+        return m_format;
+    }
+
+    //! Count of classifications, which is 1 for a uniform source.
+    std::size_t detections() const
+    {
+        return m_detections;
+    }
+
+    void reset()
+    {
+        m_format = any_date::unknown_format;
+        m_detections = 0;
+    }
+
+    template <class Iterator>
+    bool read(Iterator& pos, const Iterator& end, parts& value)
+    {
+        using category = typename std::iterator_traits<Iterator>::iterator_category;
+        return read(pos, end, value, std::is_base_of<std::forward_iterator_tag, category>());
+    }
+
+private:
+    template <class Iterator>
+    bool read(Iterator& pos, const Iterator& end, parts& value, std::true_type)
+    {
+        if (m_format != any_date::unknown_format)
+        {
+            Iterator it = pos;
+            if (any_date::read_format<Policy>(m_format, it, end, value))
+            {
+                pos = it;
+                return true;
+            }
+        }
+        return detect(pos, end, value);
+    }
+
+    template <class Iterator>
+    bool read(Iterator& pos, const Iterator& end, parts& value, std::false_type)
+    {
+        if (m_format == any_date::unknown_format)
+            return detect(pos, end, value);
+
+        if (any_date::read_format<Policy>(m_format, pos, end, value))
+            return true;
+
+        m_format = any_date::unknown_format;
+        return false;
+    }
+
+    template <class Iterator>
+    bool detect(Iterator& pos, const Iterator& end, parts& value)
+    {
+        if (!any_date::read<Policy>(pos, end, value))
+            return false;
+
+        m_format = value.format;
+        ++m_detections;
+        return true;
+    }
+
+private:
+    format_type m_format = any_date::unknown_format;
+    std::size_t m_detections = 0;
+};
+
+} // namespace date
@@ -0,0 +1,296 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include "details/iterator_traits.h"
+#include "details/prefix_iterator.h"
+#include "details/data_writers.h"
+#include "details/fmt_common.h"
+#include "details/validation_policy.h"
+#include "rfc-1123_type.h"
+#include "rfc-3339_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                                  any date
+// ----------------------------------------------------------------------------
+//! Value which is one of RFC 1123 date, RFC 3339 date or count of seconds
+//  since the epoch. The grammar is chosen by leading characters before any
+//  of them is parsed: a letter starts RFC 1123, four digits and '-' start
+//  RFC 3339, one or two digits and a space start RFC 1123 without the day
+//  name, other digits (with an optional '-') are the epoch seconds. Exactly
+//  one reader is run for the value.
+struct any_date
+{
+    using epoch_type = int64_t;
+
+    enum format_type : uint8_t
+    {
+        unknown_format = 0,
+        rfc1123_format = 1,
+        rfc3339_format = 2,
+        epoch_format   = 3,
+    };
+
+    struct parts
+    {
+        format_type    format = unknown_format;
+        rfc1123::parts rfc1123_value;
+        rfc3339::parts rfc3339_value;
+        epoch_type     epoch_seconds = 0;
+    };
+
+    template <class Policy = strict_validation>
+    static bool validate(const parts& dt)
+    {
+        switch (dt.format)
+        {
+        case rfc1123_format:
+            return rfc1123::validate<Policy>(dt.rfc1123_value);
+        case rfc3339_format:
+            return rfc3339::validate<Policy>(dt.rfc3339_value);
+        case epoch_format:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool read(Iterator& pos, const Iterator& end, parts& value)
+    {
+        using category = typename std::iterator_traits<Iterator>::iterator_category;
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        pos = skip_spaces(pos, end);
+        if (pos == end)
+            return false;
+
+        //! Digits are kept to be read again by the chosen reader: forward
+        //  iterators are rewound, input iterators are prefixed with them.
+        const Iterator start = pos;
+        char_type digits[max_epoch_digits + 1];
+        std::size_t count = 0;
+        for (; pos != end && count <= max_epoch_digits; ++pos, ++count)
+        {
+            const char_type ch = *pos;
+            if (!is_digit(ch))
+                break;
+            digits[count] = ch;
+        }
+
+        const format_type format = classify(count, pos, end);
+        switch (format)
+        {
+        case rfc1123_format:
+            return read_with<rfc1123, Policy>(digits, count, start, pos, end, value.rfc1123_value,
+                std::is_base_of<std::forward_iterator_tag, category>()) && set_format(format, value);
+        case rfc3339_format:
+            return read_with<rfc3339, Policy>(digits, count, start, pos, end, value.rfc3339_value,
+                std::is_base_of<std::forward_iterator_tag, category>()) && set_format(format, value);
+        case epoch_format:
+            return read_epoch(digits, count, pos, end, value.epoch_seconds) && set_format(format, value);
+        default:
+            return false;
+        }
+    }
+
+    //! Reads the value in the given format, without classification.
+    template <class Policy = strict_validation, class Iterator>
+    static bool read_format(format_type format, Iterator& pos, const Iterator& end, parts& value)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        pos = skip_spaces(pos, end);
+        switch (format)
+        {
+        case rfc1123_format:
+            return rfc1123::read<Policy>(pos, end, value.rfc1123_value) && set_format(format, value);
+        case rfc3339_format:
+            return rfc3339::read<Policy>(pos, end, value.rfc3339_value) && set_format(format, value);
+        case epoch_format:
+        {
+            //! Leading digits of dates are the epoch seconds too, so they
+            //  are told apart by the character which follows the digits.
+            const char_type* no_digits = nullptr;
+            std::size_t count = 0;
+            epoch_type seconds = 0;
+            const bool is_negative = (pos != end && *pos == char_type{ '-' });
+            if (!read_epoch(no_digits, count, pos, end, seconds) || (!is_negative && classify(count, pos, end) != epoch_format))
+                return false;
+            value.epoch_seconds = seconds;
+            return set_format(format, value);
+        }
+        default:
+            return false;
+        }
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool write(const parts& dt, Iterator& dst)
+    {
+        switch (dt.format)
+        {
+        case rfc1123_format:
+            return rfc1123::write<Policy>(dt.rfc1123_value, dst);
+        case rfc3339_format:
+            return rfc3339::write<Policy>(dt.rfc3339_value, dst);
+        case epoch_format:
+            return write_epoch(dt.epoch_seconds, dst);
+        default:
+            return false;
+        }
+    }
+
+private:
+    enum : std::size_t { max_epoch_digits = 18 };
+
+    template <class Char>
+    static bool is_digit(Char ch)
+    {
+        return (ch >= Char{ '0' }) && (ch <= Char{ '9' });
+    }
+
+    template <class Char>
+    static bool is_alpha(Char ch)
+    {
+        return (ch >= Char{ 'a' } && ch <= Char{ 'z' }) || (ch >= Char{ 'A' } && ch <= Char{ 'Z' });
+    }
+
+    static bool set_format(format_type format, parts& value)
+    {
+        value.format = format;
+        return true;
+    }
+
+    template <class Iterator>
+    static format_type classify(std::size_t digits, const Iterator& pos, const Iterator& end)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        if (pos == end)
+            return (digits != 0) ? epoch_format : unknown_format;
+
+        const char_type ch = *pos;
+        if (digits == 0)
+        {
+            if (is_alpha(ch))
+                return rfc1123_format;
+            if (ch == char_type{ '-' })
+                return epoch_format;
+            return unknown_format;
+        }
+        if (digits == 4 && ch == char_type{ '-' })
+            return rfc3339_format;
+        if (digits <= 2 && ch == char_type{ ' ' })
+            return rfc1123_format;
+        return epoch_format;
+    }
+
+    template <class Format, class Policy, class Char, class Iterator, class Parts>
+    static bool read_with(const Char*, std::size_t, const Iterator& start, Iterator& pos, const Iterator& end, Parts& value, std::true_type)
+    {
+        pos = start;
+        return Format::template read<Policy>(pos, end, value);
+    }
+
+    template <class Format, class Policy, class Char, class Iterator, class Parts>
+    static bool read_with(const Char* digits, std::size_t count, const Iterator&, Iterator& pos, const Iterator& end, Parts& value, std::false_type)
+    {
+        prefix_iterator<Iterator> first(digits, digits + count, pos);
+        const prefix_iterator<Iterator> last(end);
+        if (!Format::template read<Policy>(first, last, value) || first.in_prefix())
+            return false;
+        pos = first.base();
+        return true;
+    }
+
+    //! Reads '-'? digits where leading digits might be taken already; count
+    //  becomes the number of all digits.
+    template <class Char, class Iterator>
+    static bool read_epoch(const Char* digits, std::size_t& count, Iterator& pos, const Iterator& end, epoch_type& value)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        bool is_negative = false;
+        if (count == 0 && pos != end && *pos == char_type{ '-' })
+        {
+            is_negative = true;
+            ++pos;
+        }
+
+        if (count > max_epoch_digits)
+            return false;
+
+        epoch_type seconds = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            seconds = 10 * seconds + (digits[i] - Char{ '0' });
+
+        for (; pos != end; ++pos, ++count)
+        {
+            const char_type ch = *pos;
+            if (!is_digit(ch))
+                break;
+            if (count >= max_epoch_digits)
+                return false;
+            seconds = 10 * seconds + (ch - char_type{ '0' });
+        }
+
+        if (count == 0)
+            return false;
+
+        value = is_negative ? -seconds : seconds;
+        return true;
+    }
+
+    template <class Iterator>
+    static bool write_epoch(epoch_type seconds, Iterator& dst)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        char_type buffer[max_epoch_digits + 2];
+        std::size_t size = 0;
+        uint64_t rest = (seconds < 0) ? uint64_t(0) - static_cast<uint64_t>(seconds) : static_cast<uint64_t>(seconds);
+        do
+        {
+            buffer[size++] = static_cast<char_type>(char_type{ '0' } + rest % 10);
+            rest /= 10;
+        } while (rest != 0 && size <= max_epoch_digits);
+
+        if (seconds < 0)
+            characters_writer::write(dst, char_type{ '-' });
+        while (size != 0)
+            characters_writer::write(dst, buffer[--size]);
+        return true;
+    }
+};
+
+} // namespace date
@@ -0,0 +1,412 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "details/iterator_traits.h"
+#include "details/calendar_helper.h"
+#include "details/data_writers.h"
+#include "details/fmt_common.h"
+#include "details/validation_policy.h"
+#include "date_pattern_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                              compiled pattern
+// ----------------------------------------------------------------------------
+//! Date format of a strptime-like pattern which is known only at run time
+//  (see DATE_RFC_PATTERN for the same patterns known at compile time). The
+//  pattern is compiled once into an array of instructions; read and write
+//  execute them without looking at the pattern again. The program is never
+//  changed after compilation and is shared by copies, so one pattern may be
+//  used by many threads without locks.
+class compiled_pattern
+{
+public:
+    using parts = pattern_parts;
+
+    enum opcode : uint8_t
+    {
+        op_literal,         //!< run of literal characters
+        op_number,          //!< fixed-width decimal field
+        op_short_year,      //!< 2-digit year
+        op_fraction,        //!< 1-9 digits of the second fraction
+        op_month_name,      //!< abbreviated month name
+        op_week_day_name,   //!< abbreviated week day name
+        op_offset,          //!< '+hhmm' or '+hh:mm'
+    };
+
+    enum field_type : uint8_t
+    {
+        field_year,
+        field_month,
+        field_day,
+        field_hour,
+        field_minute,
+        field_second,
+    };
+
+    struct instruction
+    {
+        opcode     code   = op_literal;
+        field_type field  = field_year;
+        uint8_t    width  = 0;  //!< digits of a number field
+        uint16_t   offset = 0;  //!< first character of a literal run
+        uint16_t   length = 0;  //!< characters of a literal run
+    };
+
+    enum : std::size_t { npos = static_cast<std::size_t>(-1) };
+
+public:
+    compiled_pattern() = default;
+
+    explicit compiled_pattern(const char* pattern)
+    {
+        compile(pattern, std::strlen(pattern));
+    }
+
+    explicit compiled_pattern(const std::string& pattern)
+    {
+        compile(pattern.data(), pattern.size());
+    }
+
+    //! Whether the pattern is compiled; an invalid pattern fails all reads
+    //  and writes.
+    bool is_valid() const
+    {
+        return (m_program != nullptr);
+    }
+
+    //! Position of the first wrong character of the pattern or npos.
+    std::size_t error_position() const
+    {
+        return m_errorPosition;
+    }
+
+    const std::vector<instruction>& instructions() const
+    {
+        static const std::vector<instruction> none;
+        return is_valid() ? m_program->instructions : none;
+    }
+
+    template <class Policy = strict_validation>
+    bool validate(const parts& dt) const
+    {
+        return validate_pattern_parts<Policy>(dt);
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    bool read(Iterator& pos, const Iterator& end, parts& value) const
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        if (!is_valid())
+            return false;
+
+        pos = skip_spaces(pos, end);
+        if (pos == end)
+            return false;
+
+        parts dt{};
+        const char* literals = m_program->literals.data();
+        for (const instruction& ins : m_program->instructions)
+        {
+            unsigned number = 0;
+            switch (ins.code)
+            {
+            case op_literal:
+                for (std::size_t i = 0; i < ins.length; ++i, ++pos)
+                {
+                    if (pos == end || *pos != static_cast<char_type>(literals[ins.offset + i]))
+                        return false;
+                }
+                break;
+            case op_number:
+                if (!read_digits(pos, end, ins.width, number))
+                    return false;
+                set_field(dt, ins.field, number);
+                break;
+            case op_short_year:
+                if (!read_digits(pos, end, 2, number))
+                    return false;
+                dt.year = static_cast<parts::year_type>(number + (number < 69 ? 2000 : 1900));
+                break;
+            case op_fraction:
+                {
+                    auto fmt = format(fraction<9>(dt.nanosecond));
+                    if (!::date::read(pos, end, fmt))
+                        return false;
+                }
+                break;
+            case op_month_name:
+                {
+                    auto fmt = format(aliases(dt.month, pattern_names<char_type>::months));
+                    if (!::date::read(pos, end, fmt))
+                        return false;
+                }
+                break;
+            case op_week_day_name:
+                {
+                    auto fmt = format(aliases(dt.week_day, pattern_names<char_type>::week_days));
+                    if (!::date::read(pos, end, fmt))
+                        return false;
+                }
+                break;
+            case op_offset:
+                if (!read_offset<Policy>(pos, end, dt.offset_in_minutes))
+                    return false;
+                break;
+            }
+        }
+
+        if (!validate<Policy>(dt))
+            return false;
+
+        value = dt;
+        return true;
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    bool write(const parts& dt, Iterator& dst) const
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        if (!is_valid() || !validate<Policy>(dt))
+            return false;
+
+        const char* literals = m_program->literals.data();
+        for (const instruction& ins : m_program->instructions)
+        {
+            switch (ins.code)
+            {
+            case op_literal:
+                for (std::size_t i = 0; i < ins.length; ++i)
+                    characters_writer::write(dst, static_cast<char_type>(literals[ins.offset + i]));
+                break;
+            case op_number:
+                if (ins.width == 4)
+                    number_writer<4>::write(dst, get_field(dt, ins.field));
+                else
+                    number_writer<2>::write(dst, get_field(dt, ins.field));
+                break;
+            case op_short_year:
+                number_writer<2>::write(dst, dt.year % 100);
+                break;
+            case op_fraction:
+                number_writer<9>::write(dst, dt.nanosecond);
+                break;
+            case op_month_name:
+                characters_writer::write(dst, pattern_names<char_type>::months[dt.month - 1].first);
+                break;
+            case op_week_day_name:
+                {
+                    const auto week_day = (dt.week_day != 0) ? dt.week_day : static_cast<parts::week_day_type>(calendar_helper::day_of_week(calendar_helper::date{ dt.year, dt.month, dt.day }));
+                    characters_writer::write(dst, pattern_names<char_type>::week_days[week_day - 1].first);
+                }
+                break;
+            case op_offset:
+                {
+                    const auto offset = std::abs(dt.offset_in_minutes);
+                    characters_writer::write(dst, char_type{ (dt.offset_in_minutes < 0) ? '-' : '+' });
+                    number_writer<2>::write(dst, offset / 60);
+                    number_writer<2>::write(dst, offset % 60);
+                }
+                break;
+            }
+        }
+        return true;
+    }
+
+private:
+    struct program
+    {
+        std::vector<instruction> instructions;
+        std::string literals;
+    };
+
+    void compile(const char* pattern, std::size_t size)
+    {
+        std::shared_ptr<program> result = std::make_shared<program>();
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (pattern[i] != '%')
+            {
+                add_literal(*result, pattern[i]);
+                continue;
+            }
+
+            if (++i == size || !add_spec(*result, pattern[i]))
+            {
+                m_errorPosition = i - 1;
+                return;
+            }
+        }
+
+        if (result->instructions.empty() || result->literals.size() > 0xFFFF)
+        {
+            m_errorPosition = 0;
+            return;
+        }
+        m_program = result;
+    }
+
+    static bool add_spec(program& dst, char spec)
+    {
+        switch (spec)
+        {
+        case 'Y': add_number(dst, field_year, 4);   return true;
+        case 'm': add_number(dst, field_month, 2);  return true;
+        case 'd': add_number(dst, field_day, 2);    return true;
+        case 'H': add_number(dst, field_hour, 2);   return true;
+        case 'M': add_number(dst, field_minute, 2); return true;
+        case 'S': add_number(dst, field_second, 2); return true;
+        case 'y': add_code(dst, op_short_year);     return true;
+        case 'f': add_code(dst, op_fraction);       return true;
+        case 'b': add_code(dst, op_month_name);     return true;
+        case 'a': add_code(dst, op_week_day_name);  return true;
+        case 'z': add_code(dst, op_offset);         return true;
+        case '%': add_literal(dst, '%');            return true;
+        case 'F': return add_spec(dst, 'Y') && add_literal(dst, '-') && add_spec(dst, 'm') && add_literal(dst, '-') && add_spec(dst, 'd');
+        case 'T': return add_spec(dst, 'H') && add_literal(dst, ':') && add_spec(dst, 'M') && add_literal(dst, ':') && add_spec(dst, 'S');
+        case 'R': return add_spec(dst, 'H') && add_literal(dst, ':') && add_spec(dst, 'M');
+        default:
+            return false;
+        }
+    }
+
+    static void add_code(program& dst, opcode code)
+    {
+        instruction ins;
+        ins.code = code;
+        dst.instructions.push_back(ins);
+    }
+
+    static void add_number(program& dst, field_type field, uint8_t width)
+    {
+        instruction ins;
+        ins.code = op_number;
+        ins.field = field;
+        ins.width = width;
+        dst.instructions.push_back(ins);
+    }
+
+    //! Consecutive literal characters are merged into one run.
+    static bool add_literal(program& dst, char ch)
+    {
+        if (dst.instructions.empty() || dst.instructions.back().code != op_literal)
+        {
+            instruction ins;
+            ins.code = op_literal;
+            ins.offset = static_cast<uint16_t>(dst.literals.size());
+            dst.instructions.push_back(ins);
+        }
+        dst.literals.push_back(ch);
+        ++dst.instructions.back().length;
+        return true;
+    }
+
+    static void set_field(parts& dt, field_type field, unsigned value)
+    {
+        switch (field)
+        {
+        case field_year:   dt.year   = static_cast<parts::year_type>(value);   break;
+        case field_month:  dt.month  = static_cast<parts::month_type>(value);  break;
+        case field_day:    dt.day    = static_cast<parts::day_type>(value);    break;
+        case field_hour:   dt.hour   = static_cast<parts::hour_type>(value);   break;
+        case field_minute: dt.minute = static_cast<parts::minute_type>(value); break;
+        case field_second: dt.second = static_cast<parts::second_type>(value); break;
+        }
+    }
+
+    static unsigned get_field(const parts& dt, field_type field)
+    {
+        switch (field)
+        {
+        case field_year:   return dt.year;
+        case field_month:  return dt.month;
+        case field_day:    return dt.day;
+        case field_hour:   return dt.hour;
+        case field_minute: return dt.minute;
+        case field_second: return dt.second;
+        }
+        return 0;
+    }
+
+    template <class Iterator>
+    static bool read_digits(Iterator& pos, const Iterator& end, std::size_t width, unsigned& value)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        value = 0;
+        for (std::size_t i = 0; i < width; ++i, ++pos)
+        {
+            if (pos == end)
+                return false;
+            const char_type ch = *pos;
+            if (ch < char_type{ '0' } || ch > char_type{ '9' })
+                return false;
+            value = 10 * value + static_cast<unsigned>(ch - char_type{ '0' });
+        }
+        return true;
+    }
+
+    template <class Policy, class Iterator>
+    static bool read_offset(Iterator& pos, const Iterator& end, parts::offset_type& offset)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        if (pos == end || (*pos != char_type{ '+' } && *pos != char_type{ '-' }))
+            return false;
+        const bool is_negative = (*pos == char_type{ '-' });
+        ++pos;
+
+        unsigned hours = 0;
+        unsigned minutes = 0;
+        if (!read_digits(pos, end, 2, hours))
+            return false;
+        if (pos != end && *pos == char_type{ ':' })
+            ++pos;
+        if (!read_digits(pos, end, 2, minutes))
+            return false;
+        if (Policy::check_ranges && (hours > 23 || minutes > 59))
+            return false;
+
+        const auto value = static_cast<parts::offset_type>(hours * 60 + minutes);
+        offset = is_negative ? static_cast<parts::offset_type>(-value) : value;
+        return true;
+    }
+
+private:
+    std::shared_ptr<const program> m_program;
+    std::size_t m_errorPosition = npos;
+};
+
+} // namespace date
@@ -0,0 +1,252 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cctype>
+#include <ctime>
+#include <cstring>
+#include <iterator>
+#include "details/iterator_traits.h"
+#include "details/calendar_helper.h"
+#include "details/validation_policy.h"
+#include "rfc-1123_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                                cookie date
+// ----------------------------------------------------------------------------
+//! Lenient cookie-date of RFC 6265 (section 5.1.1): the input is split into
+//  tokens by delimiters and the first tokens which look like a time, a day of
+//  month, a month and a year are taken, in any order. Everything up to the
+//  end of input is consumed. Values are written as rfc1123-date.
+struct cookie_date
+{
+    using year_type     = rfc1123::year_type;
+    using month_type    = rfc1123::month_type;
+    using day_type      = rfc1123::day_type;
+    using week_day_type = rfc1123::week_day_type;
+    using hour_type     = rfc1123::hour_type;
+    using minute_type   = rfc1123::minute_type;
+    using second_type   = rfc1123::second_type;
+    using offset_type   = rfc1123::offset_type;
+    using parts         = rfc1123::parts;
+
+    template <class Policy = strict_validation>
+    static bool validate(const parts& dt)
+    {
+        if (Policy::check_ranges && dt.year < 1601)
+            return false;
+        return rfc1123::validate<Policy>(dt);
+    }
+
+    template <class Char>
+    static bool is_delimiter(Char ch)
+    {
+        //! %x09 / %x20-2F / %x3B-40 / %x5B-60 / %x7B-7E
+        return (ch == Char{ 0x09 }) ||
+            (ch >= Char{ 0x20 } && ch <= Char{ 0x2F }) ||
+            (ch >= Char{ 0x3B } && ch <= Char{ 0x40 }) ||
+            (ch >= Char{ 0x5B } && ch <= Char{ 0x60 }) ||
+            (ch >= Char{ 0x7B } && ch <= Char{ 0x7E });
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool read(Iterator& pos, const Iterator& end, parts& value)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        parts dt{};
+        std::memset(static_cast<void*>(&dt), 0, sizeof(parts));
+
+        //! Every production is decided by the first few characters of a token,
+        //  so only those are kept and the input is read once.
+        enum : std::size_t { token_capacity = 9 };
+        char_type token[token_capacity];
+        std::size_t token_length = 0;
+        unsigned found = 0;
+
+        for (;; ++pos)
+        {
+            const bool at_end = (pos == end);
+            const char_type ch = at_end ? char_type{ ' ' } : *pos;
+            if (!is_delimiter(ch))
+            {
+                if (token_length < token_capacity)
+                    token[token_length] = ch;
+                ++token_length;
+                continue;
+            }
+
+            if (token_length != 0)
+            {
+                found |= match_token(token, (token_length < token_capacity) ? token_length : token_capacity, found, dt);
+                token_length = 0;
+            }
+
+            if (at_end)
+                break;
+        }
+
+        if (found != found_all)
+            return false;
+
+        if (dt.year >= 70 && dt.year <= 99)
+            dt.year += 1900;
+        else if (dt.year <= 69)
+            dt.year += 2000;
+
+        if (!validate<Policy>(dt))
+            return false;
+
+        dt.week_day = calendar_helper::day_of_week(calendar_helper::date{ dt.year, dt.month, dt.day });
+        value = dt;
+        return true;
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool write(const parts& dt, Iterator& dst)
+    {
+        //! Servers should send sane-cookie-date which is rfc1123-date.
+        return rfc1123::write<Policy>(dt, dst);
+    }
+
+private:
+    enum : unsigned
+    {
+        found_time  = 1,
+        found_day   = 2,
+        found_month = 4,
+        found_year  = 8,
+        found_all   = 15,
+    };
+
+    template <class Char>
+    static bool is_digit(Char ch)
+    {
+        return (ch >= Char{ '0' }) && (ch <= Char{ '9' });
+    }
+
+    //! Reads 'min'..'max' digits at 'index'. Returns the new index or 0.
+    template <class Char, class Value>
+    static std::size_t read_digits(const Char* token, std::size_t length, std::size_t index, std::size_t min, std::size_t max, Value& value)
+    {
+        std::size_t count = 0;
+        unsigned x = 0;
+        for (; index < length && count < max && is_digit(token[index]); ++index, ++count)
+            x = 10 * x + static_cast<unsigned>(token[index] - Char{ '0' });
+        if (count < min)
+            return 0;
+        value = static_cast<Value>(x);
+        return index;
+    }
+
+    //! Digits may only be followed by the end of the token or a non-digit.
+    template <class Char>
+    static bool is_digits_end(const Char* token, std::size_t length, std::size_t index)
+    {
+        return (index == length) || !is_digit(token[index]);
+    }
+
+    template <class Char>
+    static unsigned match_token(const Char* token, std::size_t length, unsigned found, parts& dt)
+    {
+        if ((found & found_time) == 0)
+        {
+            //! time = hms-time ( non-digit *OCTET ), hms-time = 1*2DIGIT ":" 1*2DIGIT ":" 1*2DIGIT
+            hour_type hour = 0;
+            minute_type minute = 0;
+            second_type second = 0;
+            std::size_t index = read_digits(token, length, 0, 1, 2, hour);
+            if (index != 0 && index < length && token[index] == Char{ ':' })
+                index = read_digits(token, length, index + 1, 1, 2, minute);
+            else
+                index = 0;
+            if (index != 0 && index < length && token[index] == Char{ ':' })
+                index = read_digits(token, length, index + 1, 1, 2, second);
+            else
+                index = 0;
+            if (index != 0 && is_digits_end(token, length, index))
+            {
+                dt.hour = hour;
+                dt.minute = minute;
+                dt.second = second;
+                return found_time;
+            }
+        }
+
+        if ((found & found_day) == 0)
+        {
+            //! day-of-month = 1*2DIGIT ( non-digit *OCTET )
+            day_type day = 0;
+            const std::size_t index = read_digits(token, length, 0, 1, 2, day);
+            if (index != 0 && is_digits_end(token, length, index))
+            {
+                dt.day = day;
+                return found_day;
+            }
+        }
+
+        if ((found & found_month) == 0 && length >= 3)
+        {
+            //! month = ( "jan" / ... / "dec" ) *OCTET, case-insensitive
+            constexpr auto month_aliases = rfc1123::month_names<Char>();
+            for (const auto& alias : month_aliases)
+            {
+                bool is_match = true;
+                for (std::size_t i = 0; i < 3 && is_match; ++i)
+                    is_match = (to_lower(token[i]) == to_lower(alias.first[i]));
+                if (is_match)
+                {
+                    dt.month = alias.second;
+                    return found_month;
+                }
+            }
+        }
+
+        if ((found & found_year) == 0)
+        {
+            //! year = 2*4DIGIT ( non-digit *OCTET )
+            year_type year = 0;
+            const std::size_t index = read_digits(token, length, 0, 2, 4, year);
+            if (index != 0 && is_digits_end(token, length, index))
+            {
+                dt.year = year;
+                return found_year;
+            }
+        }
+
+        return 0;
+    }
+
+    template <class Char>
+    static Char to_lower(Char ch)
+    {
+        return (ch >= Char{ 'A' } && ch <= Char{ 'Z' }) ? static_cast<Char>(ch - Char{ 'A' } + Char{ 'a' }) : ch;
+    }
+};
+
+} // namespace date
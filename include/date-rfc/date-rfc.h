@@ -23,4 +23,18 @@
 //
 #pragma once
 #include "rfc-1123.h"
+#include "http-date.h"
+#include "cookie-date.h"
+#include "rfc-3164.h"
+#include "rfc-5322.h"
+#include "iso-8601.h"
+#include "any-date.h"
+#include "date_pattern.h"
+#include "compiled_pattern.h"
+#include "date_literals.h"
+#include "date_range_seek.h"
+#include "date_transcoder.h"
+#include "date_arithmetic.h"
+#include "date_ticker.h"
+#include "rfc-5424.h"
 //#include "rfc-3339.h"
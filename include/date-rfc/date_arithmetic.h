@@ -0,0 +1,246 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cstdint>
+#include "details/calendar_helper.h"
+#include "rfc-1123_type.h"
+#include "rfc-3339_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+enum date_unit
+{
+    unit_second,
+    unit_minute,
+    unit_hour,
+    unit_day,
+    unit_month,
+    unit_year,
+};
+
+// ----------------------------------------------------------------------------
+//                              date arithmetic
+// ----------------------------------------------------------------------------
+//! Calendar arithmetic on civil fields of parts, without conversions to
+//  time_t. Fields are carried only as far as needed: adding seconds within
+//  a day touches the time of day only, and days are moved by months using
+//  days_in_month (and by whole 400-year cycles for long distances).
+//  Operations act on the local time, the offset is kept. They fail (and
+//  keep the parts) when the result is out of years [1 .. 2^16-1].
+struct date_arithmetic
+{
+    enum : int64_t { days_in_cycle = 146097 };   //!< days of 400 Gregorian years
+
+    template <class Parts>
+    static bool truncate(Parts& dt, date_unit unit)
+    {
+        switch (unit)
+        {
+        case unit_year:
+            dt.month = 1;
+            // fall through
+        case unit_month:
+            dt.day = 1;
+            update_week_day(dt);
+            // fall through
+        case unit_day:
+            dt.hour = 0;
+            // fall through
+        case unit_hour:
+            dt.minute = 0;
+            // fall through
+        case unit_minute:
+            dt.second = 0;
+            // fall through
+        case unit_second:
+            clear_fraction(dt);
+            return true;
+        }
+        return false;
+    }
+
+    template <class Parts>
+    static bool add_seconds(Parts& dt, int64_t seconds)
+    {
+        const int64_t second = dt.second + seconds;
+        if (second >= 0 && second < 60)
+        {
+            dt.second = static_cast<calendar_helper::second_type>(second);
+            return true;
+        }
+
+        const int64_t minute = dt.minute + floor_div(second, 60);
+        const int64_t hour = dt.hour + floor_div(minute, 60);
+        const int64_t days = floor_div(hour, 24);
+        if (days != 0)
+        {
+            Parts result = dt;
+            if (!add_days(result, days))
+                return false;
+            dt = result;
+        }
+
+        dt.second = static_cast<calendar_helper::second_type>(floor_mod(second, 60));
+        dt.minute = static_cast<calendar_helper::minute_type>(floor_mod(minute, 60));
+        dt.hour   = static_cast<calendar_helper::hour_type>(floor_mod(hour, 24));
+        return true;
+    }
+
+    template <class Parts>
+    static bool add_days(Parts& dt, int64_t days)
+    {
+        int64_t year = dt.year + (days / days_in_cycle) * 400;
+        int64_t month = dt.month;
+        int64_t day = dt.day;
+        int64_t rest = days % days_in_cycle;
+
+        while (rest > 0)
+        {
+            const int64_t month_days = days_in_month(year, month);
+            if (day + rest <= month_days)
+            {
+                day += rest;
+                break;
+            }
+
+            rest -= month_days - day + 1;
+            day = 1;
+            if (++month > 12)
+            {
+                month = 1;
+                ++year;
+            }
+        }
+
+        while (rest < 0)
+        {
+            if (day + rest >= 1)
+            {
+                day += rest;
+                break;
+            }
+
+            rest += day;
+            if (--month < 1)
+            {
+                month = 12;
+                --year;
+            }
+            day = days_in_month(year, month);
+        }
+
+        if (year < 1 || year > 0xFFFF)
+            return false;
+
+        dt.year  = static_cast<calendar_helper::year_type>(year);
+        dt.month = static_cast<calendar_helper::month_type>(month);
+        dt.day   = static_cast<calendar_helper::day_type>(day);
+        shift_week_day(dt, days);
+        return true;
+    }
+
+private:
+    static int64_t floor_div(int64_t value, int64_t divisor)
+    {
+        const int64_t quotient = value / divisor;
+        return (value % divisor < 0) ? quotient - 1 : quotient;
+    }
+
+    static int64_t floor_mod(int64_t value, int64_t divisor)
+    {
+        const int64_t remainder = value % divisor;
+        return (remainder < 0) ? remainder + divisor : remainder;
+    }
+
+    //! Days in the month of a year which may be beyond the range of fields.
+    static int64_t days_in_month(int64_t year, int64_t month)
+    {
+        if (month != 2)
+            return calendar_helper::days_in_month(2001, static_cast<calendar_helper::month_type>(month));
+        return calendar_helper::is_leap_year(static_cast<calendar_helper::year_type>(floor_mod(year, 400))) ? 29 : 28;
+    }
+
+    static void clear_fraction(rfc3339::parts& dt)
+    {
+        dt.nanosecond = 0;
+    }
+
+    static void clear_fraction(rfc1123::parts&)
+    {}
+
+    static void update_week_day(rfc3339::parts&)
+    {}
+
+    static void update_week_day(rfc1123::parts& dt)
+    {
+        if (dt.week_day != 0)
+            dt.week_day = calendar_helper::day_of_week(calendar_helper::date{ dt.year, dt.month, dt.day });
+    }
+
+    static void shift_week_day(rfc3339::parts&, int64_t)
+    {}
+
+    static void shift_week_day(rfc1123::parts& dt, int64_t days)
+    {
+        if (dt.week_day != 0)
+            dt.week_day = static_cast<rfc1123::week_day_type>(floor_mod(dt.week_day - 1 + floor_mod(days, 7), 7) + 1);
+    }
+};
+
+// ----------------------------------------------------------------------------
+inline bool truncate(rfc3339::parts& dt, date_unit unit)
+{
+    return date_arithmetic::truncate(dt, unit);
+}
+
+inline bool truncate(rfc1123::parts& dt, date_unit unit)
+{
+    return date_arithmetic::truncate(dt, unit);
+}
+
+inline bool add_seconds(rfc3339::parts& dt, int64_t seconds)
+{
+    return date_arithmetic::add_seconds(dt, seconds);
+}
+
+inline bool add_seconds(rfc1123::parts& dt, int64_t seconds)
+{
+    return date_arithmetic::add_seconds(dt, seconds);
+}
+
+inline bool add_days(rfc3339::parts& dt, int64_t days)
+{
+    return date_arithmetic::add_days(dt, days);
+}
+
+inline bool add_days(rfc1123::parts& dt, int64_t days)
+{
+    return date_arithmetic::add_days(dt, days);
+}
+
+} // namespace date
@@ -0,0 +1,331 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "details/validation_policy.h"
+#include "date_converter.h"
+#include "rfc-1123_type.h"
+#include "rfc-3339_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+struct date_cache_stats
+{
+    uint64_t hits      = 0; //!< values found in the cache
+    uint64_t misses    = 0; //!< values parsed and inserted
+    uint64_t evictions = 0; //!< values replaced by newer ones
+    uint64_t rejects   = 0; //!< strings which are not timestamps (never cached)
+    uint64_t bypasses  = 0; //!< strings too long to be cached (parsed every time)
+};
+
+// ----------------------------------------------------------------------------
+//                                 date cache
+// ----------------------------------------------------------------------------
+//! Thread-safe cache from timestamp text to seconds since the epoch and
+//  nanoseconds, for streams where the same strings repeat often.
+//  The cache holds a bounded count of entries in sets of 'ways' slots chosen
+//  by a hash of the text; a set keeps one byte of the hash of every slot, so
+//  a lookup reads one more slot only on a likely match. Lookups take no
+//  locks: every slot is guarded by a sequence counter and a lookup which
+//  overlaps an update is treated as a miss. Insertions lock one of 'shards'
+//  mutexes (a set is always guarded by the same one) and evict the entry
+//  chosen by CLOCK: the hand skips and clears entries used since its last
+//  pass.
+template <class Format, class Policy = strict_validation, class Converter = date_converter<Format, std::time_t>>
+class date_cache
+{
+public:
+    enum : std::size_t { ways = 8 };
+    enum : std::size_t { max_key_length = 40 };     //!< longer strings are not cached
+
+public:
+    explicit date_cache(std::size_t capacity = 64 * 1024, std::size_t shards = 64)
+        : m_setsCount(round_up(capacity / ways))
+        , m_shardsCount(round_up(shards))
+        , m_sets(new set[m_setsCount]())
+        , m_mutexes(new std::mutex[m_shardsCount])
+        , m_counters(new counters[stripes_count]())
+    {}
+
+    date_cache(const date_cache&) = delete;
+    date_cache& operator=(const date_cache&) = delete;
+
+    std::size_t capacity() const
+    {
+        return m_setsCount * ways;
+    }
+
+    //! Decodes the timestamp which occupies [data, data + size) entirely.
+    bool read(const char* data, std::size_t size, std::time_t& seconds, uint32_t& nanosecond)
+    {
+        counters& own = own_counters();
+        if (size == 0 || size > max_key_length)
+        {
+            increment(own.bypasses);
+            if (parse(data, size, seconds, nanosecond))
+                return true;
+            increment(own.rejects);
+            return false;
+        }
+
+        key_type key{};
+        std::memcpy(key.words, data, size);
+        key.length = size;
+        const uint64_t hash = hash_key(key);
+        const std::size_t index = static_cast<std::size_t>(hash) & (m_setsCount - 1);
+        const uint8_t tag = static_cast<uint8_t>((hash >> 56) | 1);
+        set& target = m_sets[index];
+
+        if (find(target, key, tag, seconds, nanosecond))
+        {
+            increment(own.hits);
+            return true;
+        }
+
+        if (!parse(data, size, seconds, nanosecond))
+        {
+            increment(own.rejects);
+            return false;
+        }
+
+        increment(own.misses);
+        std::lock_guard<std::mutex> lock(m_mutexes[index & (m_shardsCount - 1)]);
+        if (insert(target, key, tag, seconds, nanosecond))
+            increment(own.evictions);
+        return true;
+    }
+
+    bool read(const std::string& text, std::time_t& seconds, uint32_t& nanosecond)
+    {
+        return read(text.data(), text.size(), seconds, nanosecond);
+    }
+
+    //! Sum of counters of all threads. Counters are read while they change,
+    //  and with more than 64 threads some increments may be lost.
+    date_cache_stats stats() const
+    {
+        date_cache_stats result;
+        for (std::size_t i = 0; i < stripes_count; ++i)
+        {
+            const counters& stripe = m_counters[i];
+            result.hits      += stripe.hits.load(std::memory_order_relaxed);
+            result.misses    += stripe.misses.load(std::memory_order_relaxed);
+            result.evictions += stripe.evictions.load(std::memory_order_relaxed);
+            result.rejects   += stripe.rejects.load(std::memory_order_relaxed);
+            result.bypasses  += stripe.bypasses.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+private:
+    enum : std::size_t { key_words_count = max_key_length / sizeof(uint64_t) };
+    enum : std::size_t { stripes_count = 64 };
+
+    struct key_type
+    {
+        uint64_t words[key_words_count];
+        uint64_t length;
+    };
+
+    //! Fields are atomic words, so a lookup may copy a slot while it changes
+    //  and detect that by the sequence counter. The key length and the
+    //  nanoseconds share a word to fit a slot into 64 bytes.
+    struct slot
+    {
+        std::atomic<uint32_t> sequence;
+        std::atomic<uint32_t> referenced;
+        std::atomic<uint64_t> words[key_words_count];
+        std::atomic<int64_t>  seconds;
+        std::atomic<uint64_t> length_nanosecond;
+    };
+
+    struct set
+    {
+        std::atomic<uint64_t> tags;     //!< byte per slot, 0 for empty slots
+        std::size_t hand;               //!< CLOCK hand, guarded by the shard mutex
+        slot slots[ways];
+    };
+
+    //! Counters of threads are kept in separate cache lines.
+    struct counters
+    {
+        std::atomic<uint64_t> hits;
+        std::atomic<uint64_t> misses;
+        std::atomic<uint64_t> evictions;
+        std::atomic<uint64_t> rejects;
+        std::atomic<uint64_t> bypasses;
+        char padding[64 - 5 * sizeof(uint64_t)];
+    };
+
+private:
+    static std::size_t round_up(std::size_t value)
+    {
+        std::size_t result = 1;
+        while (result < value)
+            result <<= 1;
+        return result;
+    }
+
+    static std::size_t used_words(const key_type& key)
+    {
+        return static_cast<std::size_t>((key.length + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    }
+
+    //! Words are multiplied independently of each other, so the products
+    //  are computed in parallel; the sum is mixed once at the end.
+    static uint64_t hash_key(const key_type& key)
+    {
+        uint64_t hash = key.length;
+        for (std::size_t i = 0; i < used_words(key); ++i)
+            hash += (key.words[i] + i) * 0x9E3779B97F4A7C15ull;
+        hash ^= hash >> 32;
+        hash *= 0xFF51AFD7ED558CCDull;
+        return hash ^ (hash >> 29);
+    }
+
+    //! Counters of a thread are changed by that thread only (unless there
+    //  are more threads than stripes), so no atomic read-modify-write.
+    static void increment(std::atomic<uint64_t>& counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    bool parse(const char* data, std::size_t size, std::time_t& seconds, uint32_t& nanosecond) const
+    {
+        const char* pos = data;
+        typename Format::parts parts;
+        if (!Format::template read<Policy>(pos, data + size, parts) || pos != data + size)
+            return false;
+        nanosecond = nanosecond_of(parts);
+        return Converter::from_parts(parts, seconds);
+    }
+
+    static uint32_t nanosecond_of(const rfc3339::parts& parts)
+    {
+        return parts.nanosecond;
+    }
+
+    static uint32_t nanosecond_of(const rfc1123::parts&)
+    {
+        return 0;
+    }
+
+    static bool find(set& target, const key_type& key, uint8_t tag, std::time_t& seconds, uint32_t& nanosecond)
+    {
+        const uint64_t tags = target.tags.load(std::memory_order_acquire);
+        for (std::size_t way = 0; way < ways; ++way)
+        {
+            if (static_cast<uint8_t>(tags >> (way * 8)) != tag)
+                continue;
+
+            slot& candidate = target.slots[way];
+            const uint32_t sequence = candidate.sequence.load(std::memory_order_acquire);
+            if ((sequence & 1) != 0)
+                continue;
+
+            bool is_equal = true;
+            for (std::size_t i = 0; is_equal && i < used_words(key); ++i)
+                is_equal = (candidate.words[i].load(std::memory_order_relaxed) == key.words[i]);
+            const int64_t found_seconds = candidate.seconds.load(std::memory_order_relaxed);
+            const uint64_t length_nanosecond = candidate.length_nanosecond.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (!is_equal || (length_nanosecond >> 32) != key.length || candidate.sequence.load(std::memory_order_relaxed) != sequence)
+                continue;
+
+            if (candidate.referenced.load(std::memory_order_relaxed) == 0)
+                candidate.referenced.store(1, std::memory_order_relaxed);
+            seconds = static_cast<std::time_t>(found_seconds);
+            nanosecond = static_cast<uint32_t>(length_nanosecond);
+            return true;
+        }
+        return false;
+    }
+
+    //! Returns true when a valid entry was evicted.
+    static bool insert(set& target, const key_type& key, uint8_t tag, std::time_t seconds, uint32_t nanosecond)
+    {
+        std::time_t found_seconds = 0;
+        uint32_t found_nanosecond = 0;
+        if (find(target, key, tag, found_seconds, found_nanosecond))
+            return false;
+
+        uint64_t tags = target.tags.load(std::memory_order_relaxed);
+        std::size_t way = ways;
+        for (std::size_t step = 0; way == ways; ++step)
+        {
+            slot& candidate = target.slots[target.hand];
+            if (static_cast<uint8_t>(tags >> (target.hand * 8)) == 0 || step >= ways * 2 || candidate.referenced.load(std::memory_order_relaxed) == 0)
+                way = target.hand;
+            else
+                candidate.referenced.store(0, std::memory_order_relaxed);
+            target.hand = (target.hand + 1) % ways;
+        }
+
+        slot& victim = target.slots[way];
+        const bool is_eviction = (static_cast<uint8_t>(tags >> (way * 8)) != 0);
+        const uint32_t sequence = victim.sequence.load(std::memory_order_relaxed);
+        victim.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (std::size_t i = 0; i < key_words_count; ++i)
+            victim.words[i].store(key.words[i], std::memory_order_relaxed);
+        victim.seconds.store(static_cast<int64_t>(seconds), std::memory_order_relaxed);
+        victim.length_nanosecond.store((key.length << 32) | nanosecond, std::memory_order_relaxed);
+        victim.referenced.store(0, std::memory_order_relaxed);
+        victim.sequence.store(sequence + 2, std::memory_order_release);
+
+        tags &= ~(uint64_t{ 0xFF } << (way * 8));
+        tags |= uint64_t{ tag } << (way * 8);
+        target.tags.store(tags, std::memory_order_release);
+        return is_eviction;
+    }
+
+    counters& own_counters()
+    {
+        static std::atomic<std::size_t> next_stripe(0);
+        static thread_local const std::size_t stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % stripes_count;
+        return m_counters[stripe];
+    }
+
+private:
+    std::size_t m_setsCount;
+    std::size_t m_shardsCount;
+    std::unique_ptr<set[]> m_sets;
+    std::unique_ptr<std::mutex[]> m_mutexes;
+    std::unique_ptr<counters[]> m_counters;
+};
+
+} // namespace date
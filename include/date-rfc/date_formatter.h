@@ -25,6 +25,7 @@
 #include <ostream>
 #include <istream>
 #include "date_converter.h"
+#include "details/validation_policy.h"
 
 // ----------------------------------------------------------------------------
 namespace date
@@ -33,24 +34,25 @@ namespace date
 // ----------------------------------------------------------------------------
 //                                  stream formatter
 // ----------------------------------------------------------------------------
-template <class Format, class Date, class Converter = date_converter<Format, Date>>
+template <class Format, class Date, class Converter = date_converter<Format, Date>, class Policy = strict_validation>
 struct format_rfc
 {
     using format_type = Format;
     using date_type = Date;
+    using policy_type = Policy;
 
     format_rfc(date_type& value, const format_type& format = format_type())
         : m_format(format), m_value(value)
     {}
 
-    template <class T, class U, class C, class Char, class Traits>
-    friend std::basic_istream<Char, Traits>& operator>>(std::basic_istream<Char, Traits>& stream, format_rfc<T, U, C>& formatter);
+    template <class T, class U, class C, class P, class Char, class Traits>
+    friend std::basic_istream<Char, Traits>& operator>>(std::basic_istream<Char, Traits>& stream, format_rfc<T, U, C, P>& formatter);
 
-    template <class T, class U, class C, class Char, class Traits>
-    friend std::basic_istream<Char, Traits>& operator>>(std::basic_istream<Char, Traits>& stream, format_rfc<T, U, C>&& formatter);
+    template <class T, class U, class C, class P, class Char, class Traits>
+    friend std::basic_istream<Char, Traits>& operator>>(std::basic_istream<Char, Traits>& stream, format_rfc<T, U, C, P>&& formatter);
 
-    template <class T, class U, class C, class Char, class Traits>
-    friend std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& stream, const format_rfc<T, U, C>& formatter);
+    template <class T, class U, class C, class P, class Char, class Traits>
+    friend std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& stream, const format_rfc<T, U, C, P>& formatter);
 
 private:
     const format_type m_format;
@@ -58,36 +60,36 @@ private:
 };
 
 // ----------------------------------------------------------------------------
-template <class Format, class Date, class Converter, class Char, class Traits>
-inline std::basic_istream<Char, Traits>& operator>>(std::basic_istream<Char, Traits>& stream, format_rfc<Format, Date, Converter>& formatter)
+template <class Format, class Date, class Converter, class Policy, class Char, class Traits>
+inline std::basic_istream<Char, Traits>& operator>>(std::basic_istream<Char, Traits>& stream, format_rfc<Format, Date, Converter, Policy>& formatter)
 {
     typename Format::parts parts{};
     std::istreambuf_iterator<Char> end{};
     std::istreambuf_iterator<Char> pos(stream.rdbuf());
-    if (!Format::read(pos, end, parts) || !Converter::from_parts(parts, formatter.m_value))
+    if (!formatter.m_format.template read<Policy>(pos, end, parts) || !Converter::from_parts(parts, formatter.m_value))
         stream.setstate(std::ios::failbit);
     return stream;
 }
 
 // ----------------------------------------------------------------------------
-template <class Format, class Date, class Converter, class Char, class Traits>
-inline std::basic_istream<Char, Traits>& operator>>(std::basic_istream<Char, Traits>& stream, format_rfc<Format, Date, Converter>&& formatter)
+template <class Format, class Date, class Converter, class Policy, class Char, class Traits>
+inline std::basic_istream<Char, Traits>& operator>>(std::basic_istream<Char, Traits>& stream, format_rfc<Format, Date, Converter, Policy>&& formatter)
 {
     typename Format::parts parts{};
     std::istreambuf_iterator<Char> end{};
     std::istreambuf_iterator<Char> pos(stream.rdbuf());
-    if (!Format::read(pos, end, parts) || !Converter::from_parts(parts, formatter.m_value))
+    if (!formatter.m_format.template read<Policy>(pos, end, parts) || !Converter::from_parts(parts, formatter.m_value))
         stream.setstate(std::ios::failbit);
     return stream;
 }
 
 // ----------------------------------------------------------------------------
-template <class Format, class Date, class Converter, class Char, class Traits>
-inline std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& stream, const format_rfc<Format, Date, Converter>& formatter)
+template <class Format, class Date, class Converter, class Policy, class Char, class Traits>
+inline std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& stream, const format_rfc<Format, Date, Converter, Policy>& formatter)
 {
     typename Format::parts parts{};
     std::ostreambuf_iterator<Char> dst(stream);
-    if (!Converter::to_parts(formatter.m_value, parts) || !Format::write(parts, dst))
+    if (!Converter::to_parts(formatter.m_value, parts) || !formatter.m_format.template write<Policy>(parts, dst))
         stream.setstate(std::ios::failbit);
     return stream;
 }
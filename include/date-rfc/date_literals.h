@@ -0,0 +1,275 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <ctime>
+#include <stdexcept>
+#include <utility>
+#include "details/config.h"
+#include "details/static_string.h"
+#include "details/validation_policy.h"
+#include "rfc-1123_type.h"
+#include "rfc-1123_converter.h"
+#include "rfc-3339_type.h"
+#include "rfc-3339_converter.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                               literal reader
+// ----------------------------------------------------------------------------
+//! Readers of whole strings given by pointers which are constexpr since
+//  C++14, so dates may be parsed at compile time. They accept the same
+//  grammars as rfc3339::read and rfc1123::read but nothing may follow the
+//  date and no spaces may precede it.
+struct literal_reader
+{
+    template <class Policy = strict_validation, class Char>
+    static DATE_RFC_CONSTEXPR14 bool read_rfc3339(const Char* pos, const Char* end, rfc3339::parts& value)
+    {
+        rfc3339::parts dt{};
+        if (!read_digits(pos, end, 4, 4, dt.year) || !read_character(pos, end, Char{ '-' }) ||
+            !read_digits(pos, end, 2, 2, dt.month) || !read_character(pos, end, Char{ '-' }) ||
+            !read_digits(pos, end, 2, 2, dt.day) || !read_character(pos, end, Char{ 'T' }) ||
+            !read_digits(pos, end, 2, 2, dt.hour) || !read_character(pos, end, Char{ ':' }) ||
+            !read_digits(pos, end, 2, 2, dt.minute) || !read_character(pos, end, Char{ ':' }) ||
+            !read_digits(pos, end, 2, 2, dt.second))
+            return false;
+
+        if (pos != end && *pos == Char{ '.' })
+        {
+            ++pos;
+            std::size_t digits = 0;
+            for (; pos != end && digits < 9 && is_digit(*pos); ++pos, ++digits)
+                dt.nanosecond = 10 * dt.nanosecond + static_cast<rfc3339::nanosec_type>(*pos - Char{ '0' });
+            if (digits == 0)
+                return false;
+            for (; digits < 9; ++digits)
+                dt.nanosecond *= 10;
+        }
+
+        if (pos != end && *pos == Char{ 'Z' })
+        {
+            ++pos;
+        }
+        else
+        {
+            bool is_negative = false;
+            if (!read_sign(pos, end, is_negative))
+                return false;
+
+            rfc3339::offset_type hours = 0;
+            rfc3339::offset_type minutes = 0;
+            if (!read_digits(pos, end, 2, 2, hours) || !read_character(pos, end, Char{ ':' }) || !read_digits(pos, end, 2, 2, minutes))
+                return false;
+            if (hours > 23 || minutes > 59)
+                return false;
+            dt.offset_in_minutes = static_cast<rfc3339::offset_type>((is_negative ? -1 : 1) * (hours * 60 + minutes));
+        }
+
+        if (pos != end || !rfc3339::validate<Policy>(dt))
+            return false;
+
+        value = dt;
+        return true;
+    }
+
+    template <class Policy = strict_validation, class Char>
+    static DATE_RFC_CONSTEXPR14 bool read_rfc1123(const Char* pos, const Char* end, rfc1123::parts& value)
+    {
+        rfc1123::parts dt{};
+        dt.week_day = 0;
+        if (pos != end && !is_digit(*pos))
+        {
+            if (!read_name(pos, end, rfc1123::weekday_names<Char>(), dt.week_day) ||
+                !read_character(pos, end, Char{ ',' }) || !read_character(pos, end, Char{ ' ' }))
+                return false;
+        }
+
+        if (!read_digits(pos, end, 1, 2, dt.day) || !read_character(pos, end, Char{ ' ' }) ||
+            !read_name(pos, end, rfc1123::month_names<Char>(), dt.month) || !read_character(pos, end, Char{ ' ' }) ||
+            !read_digits(pos, end, 2, 4, dt.year) || !read_character(pos, end, Char{ ' ' }) ||
+            !read_digits(pos, end, 2, 2, dt.hour) || !read_character(pos, end, Char{ ':' }) ||
+            !read_digits(pos, end, 2, 2, dt.minute))
+            return false;
+
+        if (pos != end && *pos == Char{ ':' })
+        {
+            ++pos;
+            if (!read_digits(pos, end, 2, 2, dt.second))
+                return false;
+        }
+
+        if (!read_character(pos, end, Char{ ' ' }))
+            return false;
+
+        bool is_negative = false;
+        if (read_sign(pos, end, is_negative))
+        {
+            rfc1123::offset_type hours = 0;
+            rfc1123::offset_type minutes = 0;
+            if (!read_digits(pos, end, 2, 2, hours) || !read_digits(pos, end, 2, 2, minutes))
+                return false;
+            dt.offset_in_minutes = static_cast<rfc1123::offset_type>((is_negative ? -1 : 1) * (hours * 60 + minutes));
+        }
+        else if (!read_name(pos, end, rfc1123::zone_names<Char>(), dt.offset_in_minutes))
+        {
+            return false;
+        }
+
+        if (dt.year < 100)
+            dt.year = static_cast<rfc1123::year_type>(dt.year + 1900);
+
+        if (pos != end || !rfc1123::validate<Policy>(dt))
+            return false;
+
+        value = dt;
+        return true;
+    }
+
+private:
+    template <class Char>
+    static constexpr bool is_digit(Char ch)
+    {
+        return (ch >= Char{ '0' }) && (ch <= Char{ '9' });
+    }
+
+    template <class Char>
+    static DATE_RFC_CONSTEXPR14 bool read_character(const Char*& pos, const Char* end, Char ch)
+    {
+        if (pos == end || *pos != ch)
+            return false;
+        ++pos;
+        return true;
+    }
+
+    template <class Char>
+    static DATE_RFC_CONSTEXPR14 bool read_sign(const Char*& pos, const Char* end, bool& is_negative)
+    {
+        if (pos == end || (*pos != Char{ '+' } && *pos != Char{ '-' }))
+            return false;
+        is_negative = (*pos == Char{ '-' });
+        ++pos;
+        return true;
+    }
+
+    template <class Char, class Value>
+    static DATE_RFC_CONSTEXPR14 bool read_digits(const Char*& pos, const Char* end, std::size_t min, std::size_t max, Value& value)
+    {
+        Value number = 0;
+        std::size_t digits = 0;
+        for (; pos != end && digits < max && is_digit(*pos); ++pos, ++digits)
+            number = static_cast<Value>(10 * number + (*pos - Char{ '0' }));
+        if (digits < min)
+            return false;
+        value = number;
+        return true;
+    }
+
+    //! Takes the longest name which matches the input.
+    template <class Char, std::size_t Length, class Value, std::size_t Count>
+    static DATE_RFC_CONSTEXPR14 bool read_name(const Char*& pos, const Char* end, const std::array<std::pair<static_string<Char, Length>, Value>, Count>& names, Value& value)
+    {
+        std::size_t matched = Count;
+        std::size_t matched_length = 0;
+        for (std::size_t k = 0; k < Count; ++k)
+        {
+            const auto& name = names[k].first;
+            const std::size_t length = name.length();
+            if (length <= matched_length || static_cast<std::size_t>(end - pos) < length)
+                continue;
+
+            std::size_t i = 0;
+            for (; i < length && pos[i] == name[i]; ++i)
+            {}
+            if (i == length)
+            {
+                matched = k;
+                matched_length = length;
+            }
+        }
+
+        if (matched == Count)
+            return false;
+        value = names[matched].second;
+        pos += matched_length;
+        return true;
+    }
+};
+
+#if DATE_RFC_HAS_CONSTEXPR14
+// ----------------------------------------------------------------------------
+//                               date literals
+// ----------------------------------------------------------------------------
+//! Literals are evaluated at compile time when they initialize constexpr
+//  variables, then a malformed literal is a compile error. Otherwise it
+//  throws std::invalid_argument at run time.
+namespace literals
+{
+
+// ----------------------------------------------------------------------------
+//! "2010-12-31T23:59:59Z"_rfc3339: seconds since the epoch.
+constexpr std::time_t operator"" _rfc3339(const char* str, std::size_t size)
+{
+    rfc3339::parts parts{};
+    std::time_t timepoint = 0;
+    if (!literal_reader::read_rfc3339(str, str + size, parts) || !date_converter<rfc3339, std::time_t>::from_parts(parts, timepoint))
+        throw std::invalid_argument("Malformed RFC 3339 date literal");
+    return timepoint;
+}
+
+// ----------------------------------------------------------------------------
+//! "2010-12-31T23:59:59.5Z"_rfc3339_tp: system clock time point which keeps
+//  the fraction of the second as far as the clock allows.
+constexpr std::chrono::system_clock::time_point operator"" _rfc3339_tp(const char* str, std::size_t size)
+{
+    rfc3339::parts parts{};
+    std::time_t timepoint = 0;
+    if (!literal_reader::read_rfc3339(str, str + size, parts) || !date_converter<rfc3339, std::time_t>::from_parts(parts, timepoint))
+        throw std::invalid_argument("Malformed RFC 3339 date literal");
+
+    using duration = std::chrono::system_clock::duration;
+    const auto since_epoch = std::chrono::seconds(timepoint) + std::chrono::nanoseconds(parts.nanosecond);
+    return std::chrono::system_clock::time_point(std::chrono::duration_cast<duration>(since_epoch));
+}
+
+// ----------------------------------------------------------------------------
+//! "Fri, 31 Dec 2010 23:59:59 GMT"_rfc1123: seconds since the epoch.
+constexpr std::time_t operator"" _rfc1123(const char* str, std::size_t size)
+{
+    rfc1123::parts parts{};
+    std::time_t timepoint = 0;
+    if (!literal_reader::read_rfc1123(str, str + size, parts) || !date_converter<rfc1123, std::time_t>::from_parts(parts, timepoint))
+        throw std::invalid_argument("Malformed RFC 1123 date literal");
+    return timepoint;
+}
+
+} // namespace literals
+#endif // DATE_RFC_HAS_CONSTEXPR14
+
+} // namespace date
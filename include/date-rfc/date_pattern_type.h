@@ -0,0 +1,503 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "details/static_string.h"
+#include "details/iterator_traits.h"
+#include "details/calendar_helper.h"
+#include "details/data_writers.h"
+#include "details/fmt_common.h"
+#include "details/validation_policy.h"
+#include "rfc-1123_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                                pattern parts
+// ----------------------------------------------------------------------------
+struct pattern_parts
+{
+    using year_type     = uint16_t;
+    using month_type    = uint8_t;
+    using day_type      = uint8_t;
+    using week_day_type = uint8_t;
+    using hour_type     = uint8_t;
+    using minute_type   = uint8_t;
+    using second_type   = uint8_t;
+    using nanosec_type  = uint32_t;
+    using offset_type   = int16_t;
+
+    year_type     year     = 1970;          //!< [1 .. 2^16-1]
+    month_type    month    = 1;             //!< [1 .. 12]
+    day_type      day      = 1;             //!< [1 .. 31]
+    week_day_type week_day = 0;             //!< [1 .. 7] where 0 is 'value not defined'.
+    hour_type     hour     = 0;             //!< [0 .. 23]
+    minute_type   minute   = 0;             //!< [0 .. 59]
+    second_type   second   = 0;             //!< [0 .. 59]
+    nanosec_type  nanosecond = 0;           //!< [0 .. 999999999]
+    offset_type   offset_in_minutes = 0;    //!< [-1439 .. 1439]
+};
+
+//! Values which are read by fields but are stored to parts after reading.
+struct pattern_scratch
+{
+    uint16_t short_year     = 0;
+    int8_t   offset_sign    = 1;
+    uint8_t  offset_hours   = 0;
+    uint8_t  offset_minutes = 0;
+};
+
+// ----------------------------------------------------------------------------
+template <class Policy = strict_validation>
+bool validate_pattern_parts(const pattern_parts& dt)
+{
+    if (Policy::check_ranges)
+    {
+        if (dt.year == 0)
+            return false;
+        if (dt.month == 0 || dt.month > 12)
+            return false;
+        if (dt.day == 0 || dt.day > 31)
+            return false;
+        if (dt.week_day > 7)
+            return false;
+        if (dt.hour > 23)
+            return false;
+        if (dt.minute > 59)
+            return false;
+        if (dt.second > 59)
+            return false;
+        if (dt.nanosecond > 999999999)
+            return false;
+        if (std::abs(dt.offset_in_minutes) > 1439)
+            return false;
+    }
+    if (Policy::check_calendar)
+    {
+        if (dt.day > calendar_helper::days_in_month(dt.year, dt.month))
+            return false;
+        if (dt.week_day != 0 && dt.week_day != calendar_helper::day_of_week(calendar_helper::date{ dt.year, dt.month, dt.day }))
+            return false;
+    }
+    return true;
+}
+
+//! Fields which are combined on finish (the offset) are checked before.
+template <class Policy = strict_validation>
+bool validate_pattern_scratch(const pattern_scratch& scratch)
+{
+    if (Policy::check_ranges)
+    {
+        if (scratch.offset_hours > 23)
+            return false;
+        if (scratch.offset_minutes > 59)
+            return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+//                               pattern fields
+// ----------------------------------------------------------------------------
+template <char Spec>
+struct pattern_unknown_spec : std::false_type
+{};
+
+//! Conversion specification '%<Spec>' of the pattern. Every field binds the
+//  same fmt_* formatters which are used by hand-written formats.
+template <char Spec>
+struct pattern_field
+{
+    static_assert(pattern_unknown_spec<Spec>::value, "Unknown conversion specification in the date pattern");
+};
+
+template <char Ch>
+struct pattern_literal
+{
+    template <class Char>
+    static std::tuple<character_t<Char>> bind(pattern_parts&, pattern_scratch&)
+    {
+        return format(character<Char>(Ch));
+    }
+
+    static void finish(pattern_parts&, const pattern_scratch&)
+    {}
+
+    template <class Iterator>
+    static void write(const pattern_parts&, Iterator& dst)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        characters_writer::write(dst, char_type(Ch));
+    }
+};
+
+template <class Value, Value pattern_parts::*Member, unsigned Width>
+struct pattern_number
+{
+    template <class Char>
+    static std::tuple<unsigned_integer_t<Value, Width, Width>> bind(pattern_parts& dt, pattern_scratch&)
+    {
+        return format(unsigned_integer<Width, Width>(dt.*Member));
+    }
+
+    static void finish(pattern_parts&, const pattern_scratch&)
+    {}
+
+    template <class Iterator>
+    static void write(const pattern_parts& dt, Iterator& dst)
+    {
+        number_writer<Width>::write(dst, dt.*Member);
+    }
+};
+
+template <class Char>
+struct pattern_names
+{
+    using names_type = std::array<std::pair<static_string<Char, 4>, uint8_t>, 12>;
+    using week_days_type = std::array<std::pair<static_string<Char, 4>, uint8_t>, 7>;
+    using signs_type = std::array<std::pair<static_string<Char, 2>, int8_t>, 2>;
+
+    static constexpr names_type months = rfc1123::month_names<Char>();
+    static constexpr week_days_type week_days = rfc1123::weekday_names<Char>();
+    static constexpr signs_type signs = {
+        std::make_pair(static_string<Char, 2>("+"), int8_t(1)),
+        std::make_pair(static_string<Char, 2>("-"), int8_t(-1)),
+    };
+};
+
+template <class Char>
+constexpr typename pattern_names<Char>::names_type pattern_names<Char>::months;
+
+template <class Char>
+constexpr typename pattern_names<Char>::week_days_type pattern_names<Char>::week_days;
+
+template <class Char>
+constexpr typename pattern_names<Char>::signs_type pattern_names<Char>::signs;
+
+//! %Y: year of 4 digits.
+template <>
+struct pattern_field<'Y'> : pattern_number<pattern_parts::year_type, &pattern_parts::year, 4>
+{};
+
+//! %m: month of 2 digits.
+template <>
+struct pattern_field<'m'> : pattern_number<pattern_parts::month_type, &pattern_parts::month, 2>
+{};
+
+//! %d: day of month of 2 digits.
+template <>
+struct pattern_field<'d'> : pattern_number<pattern_parts::day_type, &pattern_parts::day, 2>
+{};
+
+//! %H: hour of 2 digits.
+template <>
+struct pattern_field<'H'> : pattern_number<pattern_parts::hour_type, &pattern_parts::hour, 2>
+{};
+
+//! %M: minute of 2 digits.
+template <>
+struct pattern_field<'M'> : pattern_number<pattern_parts::minute_type, &pattern_parts::minute, 2>
+{};
+
+//! %S: second of 2 digits.
+template <>
+struct pattern_field<'S'> : pattern_number<pattern_parts::second_type, &pattern_parts::second, 2>
+{};
+
+//! %y: year of 2 digits, 69-99 are 19xx and 00-68 are 20xx as in POSIX.
+template <>
+struct pattern_field<'y'>
+{
+    template <class Char>
+    static std::tuple<unsigned_integer_t<uint16_t, 2, 2>> bind(pattern_parts&, pattern_scratch& scratch)
+    {
+        return format(unsigned_integer<2, 2>(scratch.short_year));
+    }
+
+    static void finish(pattern_parts& dt, const pattern_scratch& scratch)
+    {
+        dt.year = static_cast<pattern_parts::year_type>(scratch.short_year + (scratch.short_year < 69 ? 2000 : 1900));
+    }
+
+    template <class Iterator>
+    static void write(const pattern_parts& dt, Iterator& dst)
+    {
+        number_writer<2>::write(dst, dt.year % 100);
+    }
+};
+
+//! %f: fraction of the second of 1 to 9 digits, written with 9 digits.
+template <>
+struct pattern_field<'f'>
+{
+    template <class Char>
+    static std::tuple<fraction_t<pattern_parts::nanosec_type, 9>> bind(pattern_parts& dt, pattern_scratch&)
+    {
+        return format(fraction<9>(dt.nanosecond));
+    }
+
+    static void finish(pattern_parts&, const pattern_scratch&)
+    {}
+
+    template <class Iterator>
+    static void write(const pattern_parts& dt, Iterator& dst)
+    {
+        number_writer<9>::write(dst, dt.nanosecond);
+    }
+};
+
+//! %b: abbreviated month name.
+template <>
+struct pattern_field<'b'>
+{
+    template <class Char>
+    static std::tuple<aliases_t<Char, 4, uint8_t, 12>> bind(pattern_parts& dt, pattern_scratch&)
+    {
+        return format(aliases(dt.month, pattern_names<Char>::months));
+    }
+
+    static void finish(pattern_parts&, const pattern_scratch&)
+    {}
+
+    template <class Iterator>
+    static void write(const pattern_parts& dt, Iterator& dst)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        characters_writer::write(dst, pattern_names<char_type>::months[dt.month - 1].first);
+    }
+};
+
+//! %a: abbreviated week day name.
+template <>
+struct pattern_field<'a'>
+{
+    template <class Char>
+    static std::tuple<aliases_t<Char, 4, uint8_t, 7>> bind(pattern_parts& dt, pattern_scratch&)
+    {
+        return format(aliases(dt.week_day, pattern_names<Char>::week_days));
+    }
+
+    static void finish(pattern_parts&, const pattern_scratch&)
+    {}
+
+    template <class Iterator>
+    static void write(const pattern_parts& dt, Iterator& dst)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        const auto week_day = (dt.week_day != 0) ? dt.week_day : static_cast<pattern_parts::week_day_type>(calendar_helper::day_of_week(calendar_helper::date{ dt.year, dt.month, dt.day }));
+        characters_writer::write(dst, pattern_names<char_type>::week_days[week_day - 1].first);
+    }
+};
+
+//! %z: offset from UTC as '+hhmm' or '+hh:mm', written as '+hhmm'.
+template <>
+struct pattern_field<'z'>
+{
+    template <class Char>
+    using formatters = std::tuple<
+        aliases_t<Char, 2, int8_t, 2>,
+        unsigned_integer_t<uint8_t, 2, 2>,
+        optional_t<character_t<Char>>,
+        unsigned_integer_t<uint8_t, 2, 2>>;
+
+    template <class Char>
+    static formatters<Char> bind(pattern_parts&, pattern_scratch& scratch)
+    {
+        return format(
+            aliases(scratch.offset_sign, pattern_names<Char>::signs),
+            unsigned_integer<2, 2>(scratch.offset_hours),
+            optional(character<Char>(':')),
+            unsigned_integer<2, 2>(scratch.offset_minutes));
+    }
+
+    static void finish(pattern_parts& dt, const pattern_scratch& scratch)
+    {
+        dt.offset_in_minutes = static_cast<pattern_parts::offset_type>(scratch.offset_sign * (scratch.offset_hours * 60 + scratch.offset_minutes));
+    }
+
+    template <class Iterator>
+    static void write(const pattern_parts& dt, Iterator& dst)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        const auto offset = std::abs(dt.offset_in_minutes);
+        characters_writer::write(dst, char_type{ (dt.offset_in_minutes < 0) ? '-' : '+' });
+        number_writer<2>::write(dst, offset / 60);
+        number_writer<2>::write(dst, offset % 60);
+    }
+};
+
+// ----------------------------------------------------------------------------
+//                                date pattern
+// ----------------------------------------------------------------------------
+//! Format made of pattern fields, see DATE_RFC_PATTERN.
+template <class ...Fields>
+struct date_pattern
+{
+    static_assert(sizeof...(Fields) != 0, "Date pattern must not be empty");
+
+    using parts = pattern_parts;
+
+    template <class Char>
+    using formatters = decltype(std::tuple_cat(Fields::template bind<Char>(std::declval<parts&>(), std::declval<pattern_scratch&>())...));
+
+    template <class Policy = strict_validation>
+    static bool validate(const parts& dt)
+    {
+        return validate_pattern_parts<Policy>(dt);
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool read(Iterator& pos, const Iterator& end, parts& value)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        pos = skip_spaces(pos, end);
+        if (pos == end)
+            return false;
+
+        parts dt{};
+        pattern_scratch scratch{};
+        formatters<char_type> fmt = std::tuple_cat(Fields::template bind<char_type>(dt, scratch)...);
+        if (!::date::read(pos, end, fmt) || !validate_pattern_scratch<Policy>(scratch))
+            return false;
+
+        const int finished[] = { (Fields::finish(dt, scratch), 0)... };
+        (void)finished;
+
+        if (!validate<Policy>(dt))
+            return false;
+
+        value = dt;
+        return true;
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool write(const parts& dt, Iterator& dst)
+    {
+        if (!validate<Policy>(dt))
+            return false;
+
+        const int written[] = { (Fields::write(dt, dst), 0)... };
+        (void)written;
+        return true;
+    }
+};
+
+// ----------------------------------------------------------------------------
+//                               pattern parser
+// ----------------------------------------------------------------------------
+template <class ...Fields>
+struct pattern_fields
+{};
+
+template <class Fields, char ...Chars>
+struct pattern_parser;
+
+template <class ...Fields>
+struct pattern_parser<pattern_fields<Fields...>>
+{
+    using type = date_pattern<Fields...>;
+};
+
+template <class ...Fields, char ...Rest>
+struct pattern_parser<pattern_fields<Fields...>, '\0', Rest...>
+{
+    using type = date_pattern<Fields...>;
+};
+
+template <class ...Fields, char Ch, char ...Rest>
+struct pattern_parser<pattern_fields<Fields...>, Ch, Rest...>
+    : pattern_parser<pattern_fields<Fields..., pattern_literal<Ch>>, Rest...>
+{};
+
+template <class ...Fields, char Spec, char ...Rest>
+struct pattern_parser<pattern_fields<Fields...>, '%', Spec, Rest...>
+    : pattern_parser<pattern_fields<Fields..., pattern_field<Spec>>, Rest...>
+{};
+
+//! %%: the '%' character.
+template <class ...Fields, char ...Rest>
+struct pattern_parser<pattern_fields<Fields...>, '%', '%', Rest...>
+    : pattern_parser<pattern_fields<Fields..., pattern_literal<'%'>>, Rest...>
+{};
+
+//! %F: same as %Y-%m-%d.
+template <class ...Fields, char ...Rest>
+struct pattern_parser<pattern_fields<Fields...>, '%', 'F', Rest...>
+    : pattern_parser<pattern_fields<Fields...>, '%', 'Y', '-', '%', 'm', '-', '%', 'd', Rest...>
+{};
+
+//! %T: same as %H:%M:%S.
+template <class ...Fields, char ...Rest>
+struct pattern_parser<pattern_fields<Fields...>, '%', 'T', Rest...>
+    : pattern_parser<pattern_fields<Fields...>, '%', 'H', ':', '%', 'M', ':', '%', 'S', Rest...>
+{};
+
+//! %R: same as %H:%M.
+template <class ...Fields, char ...Rest>
+struct pattern_parser<pattern_fields<Fields...>, '%', 'R', Rest...>
+    : pattern_parser<pattern_fields<Fields...>, '%', 'H', ':', '%', 'M', Rest...>
+{};
+
+// ----------------------------------------------------------------------------
+template <std::size_t Length, char ...Chars>
+struct pattern_builder
+{
+    static_assert(Length < sizeof...(Chars), "Date pattern is too long");
+    using type = typename pattern_parser<pattern_fields<>, Chars...>::type;
+};
+
+template <std::size_t Length, char ...Chars>
+using make_date_pattern = typename pattern_builder<Length, Chars...>::type;
+
+} // namespace date
+
+// ----------------------------------------------------------------------------
+//! Date format type of a strptime-like pattern which is parsed at compile
+//  time, e.g. DATE_RFC_PATTERN("%Y-%m-%d %H:%M:%S"). Supported conversion
+//  specifications: %Y %y %m %d %H %M %S %f %b %a %z %F %T %R %%; any other
+//  character is matched literally. Patterns are limited to 47 characters.
+#define DATE_RFC_PATTERN_AT(s, i) ((s)[(i) < sizeof(s) ? (i) : sizeof(s) - 1])
+
+#define DATE_RFC_PATTERN(s) ::date::make_date_pattern<sizeof(s) - 1,                                                  \
+    DATE_RFC_PATTERN_AT(s,  0), DATE_RFC_PATTERN_AT(s,  1), DATE_RFC_PATTERN_AT(s,  2), DATE_RFC_PATTERN_AT(s,  3), \
+    DATE_RFC_PATTERN_AT(s,  4), DATE_RFC_PATTERN_AT(s,  5), DATE_RFC_PATTERN_AT(s,  6), DATE_RFC_PATTERN_AT(s,  7), \
+    DATE_RFC_PATTERN_AT(s,  8), DATE_RFC_PATTERN_AT(s,  9), DATE_RFC_PATTERN_AT(s, 10), DATE_RFC_PATTERN_AT(s, 11), \
+    DATE_RFC_PATTERN_AT(s, 12), DATE_RFC_PATTERN_AT(s, 13), DATE_RFC_PATTERN_AT(s, 14), DATE_RFC_PATTERN_AT(s, 15), \
+    DATE_RFC_PATTERN_AT(s, 16), DATE_RFC_PATTERN_AT(s, 17), DATE_RFC_PATTERN_AT(s, 18), DATE_RFC_PATTERN_AT(s, 19), \
+    DATE_RFC_PATTERN_AT(s, 20), DATE_RFC_PATTERN_AT(s, 21), DATE_RFC_PATTERN_AT(s, 22), DATE_RFC_PATTERN_AT(s, 23), \
+    DATE_RFC_PATTERN_AT(s, 24), DATE_RFC_PATTERN_AT(s, 25), DATE_RFC_PATTERN_AT(s, 26), DATE_RFC_PATTERN_AT(s, 27), \
+    DATE_RFC_PATTERN_AT(s, 28), DATE_RFC_PATTERN_AT(s, 29), DATE_RFC_PATTERN_AT(s, 30), DATE_RFC_PATTERN_AT(s, 31), \
+    DATE_RFC_PATTERN_AT(s, 32), DATE_RFC_PATTERN_AT(s, 33), DATE_RFC_PATTERN_AT(s, 34), DATE_RFC_PATTERN_AT(s, 35), \
+    DATE_RFC_PATTERN_AT(s, 36), DATE_RFC_PATTERN_AT(s, 37), DATE_RFC_PATTERN_AT(s, 38), DATE_RFC_PATTERN_AT(s, 39), \
+    DATE_RFC_PATTERN_AT(s, 40), DATE_RFC_PATTERN_AT(s, 41), DATE_RFC_PATTERN_AT(s, 42), DATE_RFC_PATTERN_AT(s, 43), \
+    DATE_RFC_PATTERN_AT(s, 44), DATE_RFC_PATTERN_AT(s, 45), DATE_RFC_PATTERN_AT(s, 46), DATE_RFC_PATTERN_AT(s, 47)>
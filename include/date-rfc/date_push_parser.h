@@ -0,0 +1,215 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#include <cstddef>
+#include <algorithm>
+#include "details/end_tracking_iterator.h"
+#include "details/validation_policy.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+enum class parse_status
+{
+    need_more,  //!< input so far is a valid prefix, feed more characters
+    done,       //!< value is parsed, see value() and consumed()
+    error,      //!< input does not match the format
+};
+
+// ----------------------------------------------------------------------------
+//                                push parser
+// ----------------------------------------------------------------------------
+//! Incremental parser for input which arrives in pieces (e.g. socket buffers).
+//  The format's own reader is run on the fed characters; when it stops at the
+//  end of the input the parser asks for more, also after a match which
+//  touched the end (e.g. 'G' of 'GMT'): such a value is taken only when the
+//  next piece does not extend it or by finish(). A value which lies entirely in
+//  one piece is parsed in place; only a value split between pieces has its
+//  head (at most Capacity characters) kept inside the parser.
+template <class Format, class Char = char, class Policy = strict_validation, std::size_t Capacity = 64>
+class push_parser
+{
+public:
+    using format_type = Format;
+    using char_type   = Char;
+    using parts       = typename Format::parts;
+
+public:
+    push_parser()
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        m_status = parse_status::need_more;
+        m_length = 0;
+        m_consumed = 0;
+        m_pieceStart = 0;
+        m_value = parts{};
+    }
+
+    //! Parses the next piece of input. When the status becomes 'done' only the
+    //  first consumed() characters of this piece belong to the value.
+    parse_status feed(const char_type* data, std::size_t size)
+    {
+        if (m_status != parse_status::need_more)
+            return m_status;
+
+        m_consumed = 0;
+        if (m_length == 0)
+        {
+            std::size_t length = 0;
+            bool reached_end = false;
+            if (parse(data, size, length, reached_end))
+            {
+                m_consumed = length;
+                return (m_status = parse_status::done);
+            }
+
+            if (!reached_end)
+                return (m_status = parse_status::error);
+
+            std::size_t skipped = 0;
+            while (skipped < size && is_space(data[skipped]))
+                ++skipped;
+            if (size - skipped > Capacity)
+                return (m_status = parse_status::error);
+
+            std::copy(data + skipped, data + size, m_buffer);
+            m_length = size - skipped;
+            m_consumed = size;
+            m_pieceStart = -static_cast<std::ptrdiff_t>(skipped);
+            return m_status;
+        }
+
+        const std::size_t old_length = m_length;
+        const std::size_t appended = std::min(size, Capacity - m_length);
+        std::copy(data, data + appended, m_buffer + m_length);
+        m_length += appended;
+
+        m_pieceStart = static_cast<std::ptrdiff_t>(old_length);
+
+        std::size_t length = 0;
+        bool reached_end = false;
+        if (parse(m_buffer, m_length, length, reached_end))
+        {
+            m_consumed = consumed_of_piece(length);
+            return (m_status = parse_status::done);
+        }
+
+        if (!reached_end || appended < size)
+            return (m_status = parse_status::error);
+
+        m_consumed = size;
+        return m_status;
+    }
+
+    //! Signals that no more input will come: a value which ends exactly at
+    //  the end of the fed input is taken now.
+    parse_status finish()
+    {
+        if (m_status != parse_status::need_more)
+            return m_status;
+
+        std::size_t length = 0;
+        bool reached_end = false;
+        if (m_length != 0 && parse(m_buffer, m_length, length, reached_end, true))
+        {
+            m_consumed = consumed_of_piece(length);
+            return (m_status = parse_status::done);
+        }
+        return (m_status = parse_status::error);
+    }
+
+    parse_status status() const
+    {
+        return m_status;
+    }
+
+    std::size_t consumed() const
+    {
+        return m_consumed;
+    }
+
+    const parts& value() const
+    {
+        return m_value;
+    }
+
+private:
+    static bool is_space(char_type ch)
+    {
+        return ch == char_type{ ' ' } || ch == char_type{ '\t' } || ch == char_type{ '\n' } ||
+            ch == char_type{ '\v' } || ch == char_type{ '\f' } || ch == char_type{ '\r' };
+    }
+
+    //! Characters of the last fed piece which belong to a value of the
+    //  given length in the buffer.
+    std::size_t consumed_of_piece(std::size_t length) const
+    {
+        const std::ptrdiff_t consumed = static_cast<std::ptrdiff_t>(length) - m_pieceStart;
+        return (consumed > 0) ? static_cast<std::size_t>(consumed) : 0;
+    }
+
+    //! A match which touched the end of the input is not taken unless the
+    //  input is final (reached_end stays set, so more input is requested).
+    bool parse(const char_type* data, std::size_t size, std::size_t& length, bool& reached_end, bool is_final = false)
+    {
+        //! Grammar and semantics are checked apart: a grammar failure at the
+        //  end of input means 'need more', a semantic one is final. Once the
+        //  match is complete it is read again with the policy, which also
+        //  runs the checks made only by read (e.g. of offset components).
+        using iterator = end_tracking_iterator<char_type>;
+        iterator pos(data, &reached_end);
+        const iterator end(data + size, &reached_end);
+
+        parts dt{};
+        if (!Format::template read<trusted_validation>(pos, end, dt))
+            return false;
+        if (reached_end && !is_final)
+            return false;
+
+        reached_end = false;
+        const char_type* checked = data;
+        if (!Format::template read<Policy>(checked, data + size, dt))
+            return false;
+
+        m_value = dt;
+        length = static_cast<std::size_t>(checked - data);
+        return true;
+    }
+
+private:
+    parse_status m_status;
+    std::size_t m_length;
+    std::size_t m_consumed;
+    std::ptrdiff_t m_pieceStart;    //!< buffer position of the last fed piece
+    parts m_value;
+    char_type m_buffer[Capacity];
+};
+
+} // namespace date
@@ -0,0 +1,179 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <ctime>
+#include "details/validation_policy.h"
+#include "date_converter.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                              time range seek
+// ----------------------------------------------------------------------------
+struct time_range_seek_options
+{
+    std::size_t field = 0;              //!< 0-based field where the timestamp starts
+    char        delimiter = ' ';        //!< field delimiter
+    std::size_t max_probe = 64 * 1024;  //!< bytes of unparsable lines which are skipped
+};
+
+struct time_range
+{
+    std::size_t begin = 0;  //!< offset of the first line of the range
+    std::size_t end = 0;    //!< offset after the last line of the range
+    std::size_t parses = 0; //!< count of parsed timestamps
+};
+
+//! Finds the lines of a log sorted by time whose timestamps are in the
+//  interval [from, to) by binary search over byte offsets: a probe offset is
+//  moved to the next line start and the timestamp of that line is read by
+//  Format; unparsable lines are skipped up to options.max_probe bytes. So
+//  only O(log n) lines are parsed. Unparsable lines next to the range
+//  boundaries may be included in the range.
+//  Returns false when a run of unparsable lines is longer than max_probe.
+template <class Format, class Policy = strict_validation, class Converter = date_converter<Format, std::time_t>>
+class time_range_seeker
+{
+public:
+    time_range_seeker(const char* data, std::size_t size, const time_range_seek_options& options = time_range_seek_options())
+        : m_data(data), m_size(size), m_options(options)
+    {}
+
+    bool seek(std::time_t from, std::time_t to, time_range& range) const
+    {
+        range = time_range();
+        if (!lower_bound(from, range.begin, range.parses))
+            return false;
+        if (to <= from)
+        {
+            range.end = range.begin;
+            return true;
+        }
+        return lower_bound(to, range.end, range.parses);
+    }
+
+    //! Offset of the first line whose timestamp is not less than the value.
+    bool lower_bound(std::time_t value, std::size_t& offset, std::size_t& parses) const
+    {
+        std::size_t low = 0;
+        std::size_t high = m_size;
+        while (low < high)
+        {
+            std::size_t start = line_start(low + (high - low) / 2);
+            if (start >= high)
+                start = low;
+
+            std::size_t line = 0;
+            std::size_t next = 0;
+            std::time_t timestamp = 0;
+            const probe_result found = probe(start, high, line, next, timestamp, parses);
+            if (found == probe_failed)
+                return false;
+
+            if (found == probe_none)
+                high = start;
+            else if (timestamp < value)
+                low = next;
+            else
+                high = line;
+        }
+
+        offset = low;
+        return true;
+    }
+
+    //! Reads the timestamp of the line which starts at the offset.
+    bool read_line(std::size_t offset, std::time_t& timestamp) const
+    {
+        const char* line = m_data + offset;
+        const char* end = line_end(offset);
+        const char* pos = line;
+        for (std::size_t i = 0; i < m_options.field; ++i)
+        {
+            const void* delimiter = std::memchr(pos, m_options.delimiter, static_cast<std::size_t>(end - pos));
+            if (delimiter == nullptr)
+                return false;
+            pos = static_cast<const char*>(delimiter) + 1;
+        }
+
+        typename Format::parts parts;
+        return Format::template read<Policy>(pos, end, parts) && Converter::from_parts(parts, timestamp);
+    }
+
+private:
+    enum probe_result
+    {
+        probe_found,
+        probe_none,
+        probe_failed,
+    };
+
+    //! First line start at or after the offset.
+    std::size_t line_start(std::size_t offset) const
+    {
+        if (offset == 0)
+            return 0;
+        if (offset >= m_size)
+            return m_size;
+        const void* eol = std::memchr(m_data + offset - 1, '\n', m_size - offset + 1);
+        return (eol != nullptr) ? static_cast<std::size_t>(static_cast<const char*>(eol) - m_data) + 1 : m_size;
+    }
+
+    const char* line_end(std::size_t offset) const
+    {
+        const void* eol = std::memchr(m_data + offset, '\n', m_size - offset);
+        return (eol != nullptr) ? static_cast<const char*>(eol) : m_data + m_size;
+    }
+
+    //! Finds the first parsable line in [start, high).
+    probe_result probe(std::size_t start, std::size_t high, std::size_t& line, std::size_t& next, std::time_t& timestamp, std::size_t& parses) const
+    {
+        for (line = start; line < high; line = next)
+        {
+            if (line - start > m_options.max_probe)
+                return probe_failed;
+
+            next = static_cast<std::size_t>(line_end(line) - m_data);
+            if (next < m_size)
+                ++next;
+
+            ++parses;
+            if (read_line(line, timestamp))
+                return probe_found;
+        }
+        return probe_none;
+    }
+
+private:
+    const char* m_data;
+    std::size_t m_size;
+    time_range_seek_options m_options;
+};
+
+} // namespace date
@@ -0,0 +1,242 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
+#include "date_arithmetic.h"
+#include "rfc-1123_type.h"
+#include "rfc-3339_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//! Layout of formatted strings: 'HH:MM:SS' is followed by the fraction (if
+//  the format has one) and by a suffix of fixed length.
+template <class Format>
+struct ticker_traits;
+
+template <>
+struct ticker_traits<rfc3339>
+{
+    enum : bool { has_fraction = true };
+    enum : std::size_t { suffix_length = 1 };   //!< 'Z'
+
+    static void set_nanosecond(rfc3339::parts& dt, uint32_t nanosecond)
+    {
+        dt.nanosecond = nanosecond;
+    }
+};
+
+template <>
+struct ticker_traits<rfc1123>
+{
+    enum : bool { has_fraction = false };
+    enum : std::size_t { suffix_length = 4 };   //!< ' GMT'
+
+    static void set_nanosecond(rfc1123::parts&, uint32_t)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+//                                date ticker
+// ----------------------------------------------------------------------------
+//! Formatted timestamp which moves forward in time. Within a day only the
+//  digits of the time of day (and of the fraction) which change are
+//  rewritten in place; the string is formatted anew by Format::write only
+//  when the day rolls over. The timestamp is kept in UTC.
+template <class Format>
+class date_ticker
+{
+public:
+    using parts = typename Format::parts;
+    using traits = ticker_traits<Format>;
+
+    enum : unsigned { max_precision = 9 };
+
+public:
+    //! Precision is the count of fraction digits (formats with fractions).
+    explicit date_ticker(const parts& start, unsigned precision = 0)
+        : m_parts(start)
+        , m_precision(traits::has_fraction ? (precision < max_precision ? precision : max_precision) : 0)
+    {
+        m_nanosecond = nanosecond_of(start);
+        if (m_parts.offset_in_minutes != 0)
+        {
+            m_valid = add_seconds(m_parts, -static_cast<int64_t>(m_parts.offset_in_minutes) * 60);
+            m_parts.offset_in_minutes = 0;
+        }
+        m_valid = m_valid && write_all();
+    }
+
+    bool valid() const
+    {
+        return m_valid;
+    }
+
+    const std::string& str() const
+    {
+        return m_text;
+    }
+
+    const char* c_str() const
+    {
+        return m_text.c_str();
+    }
+
+    std::size_t size() const
+    {
+        return m_text.size();
+    }
+
+    const parts& value() const
+    {
+        return m_parts;
+    }
+
+    //! Count of complete formattings (one per started day and at creation).
+    uint64_t full_writes() const
+    {
+        return m_fullWrites;
+    }
+
+    //! Fails (the ticker is not changed) when the date would go out of range.
+    bool advance(uint64_t seconds)
+    {
+        if (!m_valid || seconds > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+            return false;
+
+        if (seconds < 24 * 60 * 60)
+        {
+            const uint64_t second = m_parts.second + seconds;
+            if (second < 60)
+            {
+                m_parts.second = static_cast<calendar_helper::second_type>(second);
+                write_digits(m_timePos + 6, m_parts.second);
+                return true;
+            }
+
+            const uint64_t minute = m_parts.minute + second / 60;
+            const uint64_t hour = m_parts.hour + minute / 60;
+            if (hour < 24)
+            {
+                m_parts.second = static_cast<calendar_helper::second_type>(second % 60);
+                write_digits(m_timePos + 6, m_parts.second);
+                m_parts.minute = static_cast<calendar_helper::minute_type>(minute % 60);
+                write_digits(m_timePos + 3, m_parts.minute);
+                if (hour != m_parts.hour)
+                {
+                    m_parts.hour = static_cast<calendar_helper::hour_type>(hour);
+                    write_digits(m_timePos, m_parts.hour);
+                }
+                return true;
+            }
+        }
+
+        parts next = m_parts;
+        if (!add_seconds(next, static_cast<int64_t>(seconds)))
+            return false;
+        m_parts = next;
+        m_valid = write_all();
+        return m_valid;
+    }
+
+    bool advance_nanoseconds(uint64_t nanoseconds)
+    {
+        if (!m_valid)
+            return false;
+
+        const uint64_t fraction = m_nanosecond + nanoseconds % 1000000000;
+        const uint64_t carry = nanoseconds / 1000000000 + fraction / 1000000000;
+        if (carry != 0 && !advance(carry))
+            return false;
+
+        m_nanosecond = static_cast<uint32_t>(fraction % 1000000000);
+        traits::set_nanosecond(m_parts, m_nanosecond);
+        write_fraction();
+        return true;
+    }
+
+private:
+    static uint32_t nanosecond_of(const rfc3339::parts& dt)
+    {
+        return dt.nanosecond;
+    }
+
+    static uint32_t nanosecond_of(const rfc1123::parts&)
+    {
+        return 0;
+    }
+
+    void write_digits(std::size_t pos, unsigned value)
+    {
+        m_text[pos] = static_cast<char>('0' + value / 10);
+        m_text[pos + 1] = static_cast<char>('0' + value % 10);
+    }
+
+    void write_fraction()
+    {
+        uint32_t fraction = m_nanosecond;
+        for (unsigned i = m_precision; i < max_precision; ++i)
+            fraction /= 10;
+        for (std::size_t i = m_precision; i != 0; --i)
+        {
+            m_text[m_timePos + 8 + i] = static_cast<char>('0' + fraction % 10);
+            fraction /= 10;
+        }
+    }
+
+    bool write_all()
+    {
+        m_text.clear();
+        auto output = std::back_inserter(m_text);
+        if (!Format::write(m_parts, output))
+            return false;
+
+        m_timePos = m_text.size() - traits::suffix_length - 8;
+        if (m_precision != 0)
+        {
+            m_text.insert(m_timePos + 8, m_precision + 1, '.');
+            write_fraction();
+        }
+        ++m_fullWrites;
+        return true;
+    }
+
+private:
+    parts m_parts;
+    unsigned m_precision;
+    uint32_t m_nanosecond = 0;
+    std::string m_text;
+    std::size_t m_timePos = 0;
+    uint64_t m_fullWrites = 0;
+    bool m_valid = true;
+};
+
+} // namespace date
@@ -0,0 +1,159 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <ctime>
+#include <type_traits>
+#include "details/calendar_helper.h"
+#include "details/config.h"
+#include "date_converter.h"
+#include "rfc-1123_converter.h"
+#include "rfc-3339_converter.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//! Converts parts of one format into parts of another one in UTC. The general
+//  case goes through time_t; specializations copy civil fields directly and
+//  use the epoch arithmetic only when an offset must be normalized.
+template <class From, class To, class = void>
+struct date_transcoder
+{
+    static DATE_RFC_CONSTEXPR14 bool transcode(const typename From::parts& from, typename To::parts& to)
+    {
+        std::time_t timepoint = 0;
+        return date_converter<From, std::time_t>::from_parts(from, timepoint)
+            && date_converter<To, std::time_t>::to_parts(timepoint, to);
+    }
+};
+
+// ----------------------------------------------------------------------------
+//! RFC 1123 like formats (HTTP-date, RFC 5322, cookie-date) into RFC 3339
+//  like formats (ISO 8601).
+template <class From, class To>
+struct date_transcoder<From, To, typename std::enable_if<
+    std::is_same<typename From::parts, rfc1123::parts>::value &&
+    std::is_same<typename To::parts, rfc3339::parts>::value>::type>
+{
+    static DATE_RFC_CONSTEXPR14 bool transcode(const rfc1123::parts& from, rfc3339::parts& to)
+    {
+        if (from.offset_in_minutes != 0)
+        {
+            std::time_t timepoint = 0;
+            return date_converter<rfc1123, std::time_t>::from_parts(from, timepoint)
+                && date_converter<rfc3339, std::time_t>::to_parts(timepoint, to);
+        }
+
+        to.year       = from.year;
+        to.month      = from.month;
+        to.day        = from.day;
+        to.hour       = from.hour;
+        to.minute     = from.minute;
+        to.second     = from.second;
+        to.nanosecond = 0;
+        to.offset_in_minutes = 0;
+        return true;
+    }
+};
+
+// ----------------------------------------------------------------------------
+//! RFC 3339 like formats into RFC 1123 like formats: the week day is computed
+//  and the fraction of a second is truncated.
+template <class From, class To>
+struct date_transcoder<From, To, typename std::enable_if<
+    std::is_same<typename From::parts, rfc3339::parts>::value &&
+    std::is_same<typename To::parts, rfc1123::parts>::value>::type>
+{
+    static DATE_RFC_CONSTEXPR14 bool transcode(const rfc3339::parts& from, rfc1123::parts& to)
+    {
+        if (from.offset_in_minutes != 0)
+        {
+            std::time_t timepoint = 0;
+            return date_converter<rfc3339, std::time_t>::from_parts(from, timepoint)
+                && date_converter<rfc1123, std::time_t>::to_parts(timepoint, to);
+        }
+
+        to.year     = from.year;
+        to.month    = from.month;
+        to.day      = from.day;
+        to.week_day = calendar_helper::day_of_week(calendar_helper::date{ from.year, from.month, from.day });
+        to.hour     = from.hour;
+        to.minute   = from.minute;
+        to.second   = from.second;
+        to.offset_in_minutes = 0;
+        return true;
+    }
+};
+
+// ----------------------------------------------------------------------------
+//! RFC 3339 like formats (ISO 8601, RFC 5424) into RFC 3339 like formats: the
+//  fraction of a second is kept. RFC 5424 NILVALUE can not be transcoded.
+template <class From, class To>
+struct date_transcoder<From, To, typename std::enable_if<
+    std::is_base_of<rfc3339::parts, typename From::parts>::value &&
+    std::is_base_of<rfc3339::parts, typename To::parts>::value>::type>
+{
+    static DATE_RFC_CONSTEXPR14 bool transcode(const typename From::parts& from, typename To::parts& to)
+    {
+        if (is_nil(from))
+            return false;
+
+        rfc3339::parts dt = from;
+        if (dt.offset_in_minutes != 0)
+        {
+            std::time_t timepoint = 0;
+            if (!date_converter<rfc3339, std::time_t>::from_parts(dt, timepoint) ||
+                !date_converter<rfc3339, std::time_t>::to_parts(timepoint, dt))
+                return false;
+            dt.nanosecond = from.nanosecond;
+        }
+
+        to = typename To::parts{};
+        static_cast<rfc3339::parts&>(to) = dt;
+        return true;
+    }
+
+private:
+    template <class Parts>
+    static constexpr bool is_nil(const Parts& dt, decltype(dt.nil)* = nullptr)
+    {
+        return dt.nil;
+    }
+
+    static constexpr bool is_nil(const rfc3339::parts&)
+    {
+        return false;
+    }
+};
+
+// ----------------------------------------------------------------------------
+template <class From, class To>
+DATE_RFC_CONSTEXPR14 bool transcode(const typename From::parts& from, typename To::parts& to)
+{
+    return date_transcoder<From, To>::transcode(from, to);
+}
+
+} // namespace date
@@ -0,0 +1,69 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#include <cstdint>
+#include <iterator>
+#include "details/validation_policy.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                                  validator
+// ----------------------------------------------------------------------------
+//! Checks grammar and calendar of a single value without producing parts.
+template <class Format, class Policy = strict_validation, class Iterator>
+bool validate_only(Iterator& pos, const Iterator& end)
+{
+    return Format::template validate_only<Policy>(pos, end);
+}
+
+// ----------------------------------------------------------------------------
+//! Checks every value of [first, last) (any range with begin/end, e.g.
+//  std::string) and sets bit (i % 64) of mask[i / 64] when the i-th value is
+//  a well-formed timestamp with nothing after it. The mask must hold at least
+//  (count + 63) / 64 words. Returns the number of valid values.
+template <class Format, class Policy = strict_validation, class InputIt>
+std::size_t validate_batch(InputIt first, InputIt last, std::uint64_t* mask)
+{
+    std::size_t index = 0;
+    std::size_t valid_count = 0;
+    for (; first != last; ++first, ++index)
+    {
+        if (index % 64 == 0)
+            mask[index / 64] = 0;
+
+        auto pos = std::begin(*first);
+        const auto end = std::end(*first);
+        if (!Format::template validate_only<Policy>(pos, end) || pos != end)
+            continue;
+
+        mask[index / 64] |= std::uint64_t{ 1 } << (index % 64);
+        ++valid_count;
+    }
+    return valid_count;
+}
+
+} // namespace date
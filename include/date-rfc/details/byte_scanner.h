@@ -0,0 +1,93 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(DATE_RFC_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+# define DATE_RFC_SSE2 1
+# include <emmintrin.h>
+# if defined(_MSC_VER)
+#  include <intrin.h>
+# endif
+#endif
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                              byte scanning
+// ----------------------------------------------------------------------------
+//! Byte search kernels over contiguous char buffers. SSE2 is used when it is
+//  available (define DATE_RFC_NO_SIMD to disable), plain loops otherwise.
+struct byte_scanner
+{
+#if defined(DATE_RFC_SSE2)
+    static unsigned first_bit(unsigned mask)
+    {
+# if defined(_MSC_VER)
+        unsigned long index = 0;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+# else
+        return static_cast<unsigned>(__builtin_ctz(mask));
+# endif
+    }
+#endif
+
+    //! Returns the first position of 'ch' in [begin, end) or 'end'.
+    static const char* find(const char* begin, const char* end, char ch)
+    {
+        const void* found = std::memchr(begin, ch, static_cast<std::size_t>(end - begin));
+        return (found != nullptr) ? static_cast<const char*>(found) : end;
+    }
+
+    //! Returns the first position of 'ch1' or 'ch2' in [begin, end) or 'end'.
+    static const char* find_either(const char* begin, const char* end, char ch1, char ch2)
+    {
+        const char* pos = begin;
+#if defined(DATE_RFC_SSE2)
+        const __m128i pattern1 = _mm_set1_epi8(ch1);
+        const __m128i pattern2 = _mm_set1_epi8(ch2);
+        for (; end - pos >= 16; pos += 16)
+        {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos));
+            const __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(chunk, pattern1), _mm_cmpeq_epi8(chunk, pattern2));
+            const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(matches));
+            if (mask != 0)
+                return pos + first_bit(mask);
+        }
+#endif
+        for (; pos != end; ++pos)
+        {
+            if (*pos == ch1 || *pos == ch2)
+                return pos;
+        }
+        return end;
+    }
+};
+
+} // namespace date
@@ -25,6 +25,7 @@
 #include <cctype>
 #include <ctime>
 #include <tuple>
+#include "config.h"
 
 // ----------------------------------------------------------------------------
 namespace date
@@ -60,7 +61,7 @@ struct calendar_helper
 
     struct date
     {
-        date(year_type year, month_type month, day_type day)
+        constexpr date(year_type year, month_type month, day_type day)
             : year(year), month(month), day(day) {}
 
         year_type  year  = 1970; //!< [1 .. 2^16-1]
@@ -70,7 +71,7 @@ struct calendar_helper
 
     struct time
     {
-        time(hour_type hour, minute_type minute, second_type second)
+        constexpr time(hour_type hour, minute_type minute, second_type second)
             : hour(hour), minute(minute), second(second) {}
 
         hour_type   hour   = 0;    //!< [0 .. 23]
@@ -80,23 +81,23 @@ struct calendar_helper
 
     struct date_time : date, time
     {
-        date_time(year_type year, month_type month, day_type day, hour_type hour, minute_type minute, second_type second)
+        constexpr date_time(year_type year, month_type month, day_type day, hour_type hour, minute_type minute, second_type second)
             : date(year, month, day), time(hour, minute, second) {}
     };
 
-    static week_day day_of_week(const date& date)
+    static DATE_RFC_CONSTEXPR14 week_day day_of_week(const date& date)
     {
         const auto m = date.month + (date.month < 3 ? 12 : 0);
         const auto y = date.year - (date.month < 3 ? 1 : 0);
         return static_cast<week_day>((date.day + (153 * m - 457) / 5 + 365 * y + y / 4 - y / 100 + y / 400 + 1) % 7 + 1);
     }
 
-    static bool is_leap_year(year_type year)
+    static DATE_RFC_CONSTEXPR14 bool is_leap_year(year_type year)
     {
         return (year % 4 == 0) && ((year % 100 != 0) || (year % 400 == 0));
     }
 
-    static day_type days_in_month(year_type year, month_type month)
+    static DATE_RFC_CONSTEXPR14 day_type days_in_month(year_type year, month_type month)
     {
         if (month == 2)
             return is_leap_year(year) ? 29 : 28;
@@ -105,7 +106,7 @@ struct calendar_helper
         return 31;
     }
 
-    static seconds_count to_seconds_count(const date_time& dt)
+    static DATE_RFC_CONSTEXPR14 seconds_count to_seconds_count(const date_time& dt)
     {
         const seconds_count k = (dt.month < 3 ? 1 : 0);
         const seconds_count m = dt.month + 12 * k;
@@ -114,7 +115,7 @@ struct calendar_helper
         return static_cast<seconds_count>(d * 24 * 60 * 60 + dt.hour * 60 * 60 + dt.minute * 60 + dt.second);
     }
 
-    static date_time from_seconds_count(seconds_count seconds)
+    static DATE_RFC_CONSTEXPR14 date_time from_seconds_count(seconds_count seconds)
     {
         const seconds_count days_count = seconds / (24 * 60 * 60);
         const seconds_count z = days_count + 306;
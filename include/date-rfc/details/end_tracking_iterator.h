@@ -0,0 +1,93 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#include <cstddef>
+#include <iterator>
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                            end tracking iterator
+// ----------------------------------------------------------------------------
+//! Pointer iterator which remembers whether it has ever been found equal to
+//  another one, i.e. whether a reader has run into the end of the input.
+//  Used to tell "input is malformed" from "input is not complete yet".
+template <class Char>
+class end_tracking_iterator
+{
+public:
+    using value_type        = Char;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const Char*;
+    using reference         = const Char&;
+    using iterator_category = std::forward_iterator_tag;
+
+public:
+    end_tracking_iterator() = default;
+    end_tracking_iterator(const Char* ptr, bool* reached_end) : m_ptr(ptr), m_reachedEnd(reached_end) {}
+
+    const Char* get() const
+    {
+        return m_ptr;
+    }
+
+    end_tracking_iterator& operator++()
+    {
+        ++m_ptr;
+        return *this;
+    }
+
+    end_tracking_iterator operator++(int)
+    {
+        end_tracking_iterator result(*this);
+        ++m_ptr;
+        return result;
+    }
+
+    reference operator*() const
+    {
+        return *m_ptr;
+    }
+
+    bool operator==(const end_tracking_iterator& rhs) const
+    {
+        const bool is_equal = (m_ptr == rhs.m_ptr);
+        if (is_equal && m_reachedEnd != nullptr)
+            *m_reachedEnd = true;
+        return is_equal;
+    }
+
+    bool operator!=(const end_tracking_iterator& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+private:
+    const Char* m_ptr = nullptr;
+    bool* m_reachedEnd = nullptr;
+};
+
+} // namespace date
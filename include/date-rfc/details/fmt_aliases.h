@@ -44,7 +44,7 @@ namespace date
 // ----------------------------------------------------------------------------
 //                               types: aliases
 // ----------------------------------------------------------------------------
-template <class Char, std::size_t Length, class Value, std::size_t Count>
+template <class Char, std::size_t Length, class Value, std::size_t Count, bool IgnoreCase = false>
 struct aliases_t
 {
     using value_type = Value;
@@ -53,6 +53,7 @@ struct aliases_t
     enum : unsigned { min_length = Length };
     enum : unsigned { max_length = Length };
     enum : bool { need_cache = false };
+    enum : bool { ignore_case = IgnoreCase };
 
     aliases_t(value_type& value, const aliases_type& aliases) : value(value), aliases(aliases) {}
     ~aliases_t() = default;
@@ -69,8 +70,30 @@ static aliases_t<Char, Length, Value, Count> aliases(Value& value, const std::ar
 }
 
 // ----------------------------------------------------------------------------
-template <class Iterator, class Char, std::size_t Length, class Value, std::size_t Count, class ...Others>
-bool read_impl(Iterator& pos, const Iterator& end, aliases_t<Char, Length, Value, Count>& fmt, Others&&... others)
+//! Same as aliases() but ASCII letters are compared case-insensitively.
+template <class Char, std::size_t Length, class Value, std::size_t Count>
+static aliases_t<Char, Length, Value, Count, true> aliases_icase(Value& value, const std::array<std::pair<static_string<Char, Length>, Value>, Count>& aliases)
+{
+    return aliases_t<Char, Length, Value, Count, true>{ value, aliases };
+}
+
+// ----------------------------------------------------------------------------
+template <bool IgnoreCase, class Char, class InputChar>
+bool alias_character_equal(InputChar input, Char alias)
+{
+    if (IgnoreCase)
+    {
+        if (input >= InputChar{ 'A' } && input <= InputChar{ 'Z' })
+            input = static_cast<InputChar>(input - InputChar{ 'A' } + InputChar{ 'a' });
+        if (alias >= Char{ 'A' } && alias <= Char{ 'Z' })
+            alias = static_cast<Char>(alias - Char{ 'A' } + Char{ 'a' });
+    }
+    return (input == alias);
+}
+
+// ----------------------------------------------------------------------------
+template <class Iterator, class Char, std::size_t Length, class Value, std::size_t Count, bool IgnoreCase, class ...Others>
+bool read_impl(Iterator& pos, const Iterator& end, aliases_t<Char, Length, Value, Count, IgnoreCase>& fmt, Others&&... others)
 {
     using char_type = typename iterator_traits<Iterator>::value_type;
 
@@ -95,7 +118,7 @@ bool read_impl(Iterator& pos, const Iterator& end, aliases_t<Char, Length, Value
                 continue;
             
             const Char* str = str_list[k];
-            if (*str != ch)
+            if (!alias_character_equal<IgnoreCase>(ch, *str))
             {
                 is_match[k] = false;
                 continue;
@@ -71,15 +71,28 @@ std::tuple<Formatters...> format(Formatters&& ...formatters)
     return std::make_tuple(std::forward<Formatters>(formatters)...);
 }
 
+// ----------------------------------------------------------------------------
+//! Reads formats from inputs of the iterator type; inputs with their own way
+//  of reading specialize it (e.g. details/segmented_iterator.h).
+template <class Iterator, class = void>
+struct format_reader
+{
+    template <class ...Formatters>
+    static bool read(Iterator& pos, const Iterator& end, std::tuple<Formatters...>& format)
+    {
+        enum : unsigned { max_length = args_traits<Formatters...>::max_length };
+        enum : bool { need_cache = args_traits<Formatters...>::need_cache && input_traits<Iterator>::need_cache };
+
+        input_wrapper_t<Iterator, max_length, need_cache> wrapper(pos, end);
+        return read_impl(wrapper.begin(), wrapper.end(), format, std_impl::make_index_sequence<sizeof...(Formatters)>{});
+    }
+};
+
 // ----------------------------------------------------------------------------
 template <class Iterator, class ...Formatters>
 bool read(Iterator& pos, const Iterator& end, std::tuple<Formatters...>& format)
 {
-    enum : unsigned { max_length = args_traits<Formatters...>::max_length };
-    enum : bool { need_cache = args_traits<Formatters...>::need_cache && input_traits<Iterator>::need_cache };
-    
-    input_wrapper_t<Iterator, max_length, need_cache> wrapper(pos, end);
-    return read_impl(wrapper.begin(), wrapper.end(), format, std_impl::make_index_sequence<sizeof...(Formatters)>{});
+    return format_reader<Iterator>::read(pos, end, format);
 }
 
 } // namespace date
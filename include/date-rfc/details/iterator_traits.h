@@ -1,7 +1,9 @@
 #pragma once
 #include <algorithm>
 #include <iterator>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 // ----------------------------------------------------------------------------
 namespace date
@@ -63,4 +65,24 @@ struct iterator_traits<std::ostreambuf_iterator<Args...>>
     using value_type = typename std::ostreambuf_iterator<Args...>::char_type;
 };
 
+// ----------------------------------------------------------------------------
+//! Whether characters of the iterator are stored contiguously in memory,
+//  so that '&*pos' may be read as a plain array.
+template <class T, class Char>
+struct is_contiguous_iterator_of : std::integral_constant<bool,
+    std::is_same<T, typename std::basic_string<Char>::iterator>::value ||
+    std::is_same<T, typename std::basic_string<Char>::const_iterator>::value ||
+    std::is_same<T, typename std::vector<Char>::iterator>::value ||
+    std::is_same<T, typename std::vector<Char>::const_iterator>::value>
+{};
+
+template <class T>
+struct is_contiguous_iterator : std::integral_constant<bool,
+    std::is_pointer<T>::value ||
+    is_contiguous_iterator_of<T, char>::value ||
+    is_contiguous_iterator_of<T, wchar_t>::value ||
+    is_contiguous_iterator_of<T, char16_t>::value ||
+    is_contiguous_iterator_of<T, char32_t>::value>
+{};
+
 } // namespace date
@@ -0,0 +1,101 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include "iterator_traits.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                              prefix iterator
+// ----------------------------------------------------------------------------
+//! Input iterator which first yields characters already taken from the
+//  underlying iterator and then continues with the iterator itself. It lets
+//  a reader look ahead over several characters of an input iterator and then
+//  hand the whole input to another reader.
+template <class Iterator>
+class prefix_iterator
+{
+public:
+    using value_type        = typename iterator_traits<Iterator>::value_type;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const value_type*;
+    using reference         = value_type;
+    using iterator_category = std::input_iterator_tag;
+
+public:
+    prefix_iterator(const value_type* first, const value_type* last, const Iterator& base)
+        : m_first(first), m_last(last), m_base(base)
+    {}
+
+    explicit prefix_iterator(const Iterator& base)
+        : m_base(base)
+    {}
+
+    //! The underlying iterator, it is the position only when the prefix has
+    //  been passed.
+    const Iterator& base() const
+    {
+        return m_base;
+    }
+
+    bool in_prefix() const
+    {
+        return (m_first != m_last);
+    }
+
+    prefix_iterator& operator++()
+    {
+        if (m_first != m_last)
+            ++m_first;
+        else
+            ++m_base;
+        return *this;
+    }
+
+    value_type operator*() const
+    {
+        return (m_first != m_last) ? *m_first : *m_base;
+    }
+
+    bool operator==(const prefix_iterator& rhs) const
+    {
+        return !in_prefix() && !rhs.in_prefix() && (m_base == rhs.m_base);
+    }
+
+    bool operator!=(const prefix_iterator& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+private:
+    const value_type* m_first = nullptr;
+    const value_type* m_last = nullptr;
+    Iterator m_base;
+};
+
+} // namespace date
@@ -0,0 +1,233 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include "iterator_traits.h"
+#include "index_sequence.h"
+#include "input_wrapper.h"
+#include "fmt_traits.h"
+#include "fmt_common.h"
+#include "end_tracking_iterator.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+# include <sys/uio.h>
+#endif
+
+#ifdef __GNUC__
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wpedantic"
+# if __GNUC__ < 5
+//! GCC 4.9 Bug 61489 Wrong warning with -Wmissing-field-initializers.
+#  pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+# endif
+#endif
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                               memory segments
+// ----------------------------------------------------------------------------
+template <class Char>
+struct memory_segment
+{
+    const Char* data;
+    std::size_t size;
+};
+
+// ----------------------------------------------------------------------------
+template <class Char, class Segment>
+struct segment_traits
+{
+    static const Char* data(const Segment& segment) { return segment.data; }
+    static std::size_t size(const Segment& segment) { return segment.size; }
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+// ----------------------------------------------------------------------------
+template <class Char>
+struct segment_traits<Char, ::iovec>
+{
+    static const Char* data(const ::iovec& segment) { return static_cast<const Char*>(segment.iov_base); }
+    static std::size_t size(const ::iovec& segment) { return segment.iov_len / sizeof(Char); }
+};
+#endif
+
+// ----------------------------------------------------------------------------
+//                             segmented iterator
+// ----------------------------------------------------------------------------
+//! Forward iterator over a sequence of memory segments (an iovec array, or the
+//  two halves of a wrapped ring buffer) which are read as one input. Opt-in:
+//  include this header to read segments chunk by chunk without copying.
+template <class Char, class Segment = memory_segment<Char>>
+class segmented_iterator
+{
+public:
+    using value_type        = Char;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const Char*;
+    using reference         = const Char&;
+    using iterator_category = std::forward_iterator_tag;
+    using traits_type       = segment_traits<Char, Segment>;
+
+public:
+    segmented_iterator() = default;
+
+    segmented_iterator(const Segment* segments, std::size_t count, std::size_t index = 0, std::size_t offset = 0)
+        : m_segments(segments), m_count(count), m_index(index), m_offset(offset)
+    {
+        skip_exhausted();
+    }
+
+    segmented_iterator& operator++()
+    {
+        ++m_offset;
+        skip_exhausted();
+        return *this;
+    }
+
+    segmented_iterator operator++(int)
+    {
+        segmented_iterator result(*this);
+        ++(*this);
+        return result;
+    }
+
+    reference operator*() const
+    {
+        return traits_type::data(m_segments[m_index])[m_offset];
+    }
+
+    bool operator==(const segmented_iterator& rhs) const
+    {
+        return (m_index == rhs.m_index) && (m_offset == rhs.m_offset);
+    }
+
+    bool operator!=(const segmented_iterator& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    //! Contiguous characters from the current position up to the end of the
+    //  current segment or up to 'end', whichever comes first.
+    const Char* chunk_data() const
+    {
+        return (m_index < m_count) ? traits_type::data(m_segments[m_index]) + m_offset : nullptr;
+    }
+
+    std::size_t chunk_size(const segmented_iterator& end) const
+    {
+        if (m_index >= m_count)
+            return 0;
+        if (m_index == end.m_index)
+            return end.m_offset - m_offset;
+        return traits_type::size(m_segments[m_index]) - m_offset;
+    }
+
+    bool chunk_is_last(const segmented_iterator& end) const
+    {
+        return (m_index == end.m_index);
+    }
+
+    //! Moves forward inside the current chunk.
+    void skip(std::size_t count)
+    {
+        m_offset += count;
+        skip_exhausted();
+    }
+
+private:
+    void skip_exhausted()
+    {
+        while (m_index < m_count && m_offset >= traits_type::size(m_segments[m_index]))
+        {
+            ++m_index;
+            m_offset = 0;
+        }
+    }
+
+private:
+    const Segment* m_segments = nullptr;
+    std::size_t m_count = 0;
+    std::size_t m_index = 0;
+    std::size_t m_offset = 0;
+};
+
+// ----------------------------------------------------------------------------
+template <class Char, class Segment>
+segmented_iterator<Char, Segment> segments_begin(const Segment* segments, std::size_t count)
+{
+    return segmented_iterator<Char, Segment>(segments, count);
+}
+
+// ----------------------------------------------------------------------------
+template <class Char, class Segment>
+segmented_iterator<Char, Segment> segments_end(const Segment* segments, std::size_t count)
+{
+    return segmented_iterator<Char, Segment>(segments, count, count);
+}
+
+// ----------------------------------------------------------------------------
+//! Reads the format from the current chunk through plain pointers. A match
+//  which ran into the end of a chunk (other than the last one) may go on in
+//  the next chunk (e.g. 'G' of 'GMT'), so then the value is re-read across
+//  segments.
+template <class Char, class Segment>
+struct format_reader<segmented_iterator<Char, Segment>, void>
+{
+    using iterator = segmented_iterator<Char, Segment>;
+
+    template <class ...Formatters>
+    static bool read(iterator& pos, const iterator& end, std::tuple<Formatters...>& format)
+    {
+        using tracking_iterator = end_tracking_iterator<Char>;
+
+        const Char* chunk = pos.chunk_data();
+        const std::size_t chunk_size = pos.chunk_size(end);
+
+        bool reached_end = false;
+        tracking_iterator chunk_pos(chunk, &reached_end);
+        const tracking_iterator chunk_end(chunk + chunk_size, &reached_end);
+        const bool is_read = read_impl(chunk_pos, chunk_end, format, std_impl::make_index_sequence<sizeof...(Formatters)>{});
+        if (!reached_end || pos.chunk_is_last(end))
+        {
+            if (is_read)
+                pos.skip(static_cast<std::size_t>(chunk_pos.get() - chunk));
+            return is_read;
+        }
+
+        enum : unsigned { max_length = args_traits<Formatters...>::max_length };
+        input_wrapper_t<iterator, max_length, false> wrapper(pos, end);
+        return read_impl(wrapper.begin(), wrapper.end(), format, std_impl::make_index_sequence<sizeof...(Formatters)>{});
+    }
+};
+
+} // namespace date
+
+#ifdef __GNUC__
+# pragma GCC diagnostic pop
+#endif
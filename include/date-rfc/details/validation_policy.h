@@ -0,0 +1,56 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                            validation policies
+// ----------------------------------------------------------------------------
+//! Full check: field ranges and calendar consistency (days in month, week day).
+struct strict_validation
+{
+    enum : bool { check_ranges = true };
+    enum : bool { check_calendar = true };
+};
+
+//! Field ranges only (01-12, 00-23 etc. as annotated in the grammars),
+//  neither days in month nor week day are recomputed.
+struct syntax_validation
+{
+    enum : bool { check_ranges = true };
+    enum : bool { check_calendar = false };
+};
+
+//! No semantic checks at all: values are known to be valid (e.g. produced
+//  by a converter or by an upstream strict reader).
+struct trusted_validation
+{
+    enum : bool { check_ranges = false };
+    enum : bool { check_calendar = false };
+};
+
+} // namespace date
@@ -0,0 +1,96 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include "http-date_type.h"
+#include "http-date_converter.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                           cached http date
+// ----------------------------------------------------------------------------
+//! Time point together with its IMF-fixdate text, e.g. the Last-Modified
+//  value of a cached response.
+struct http_cached_date
+{
+    std::time_t time = 0;
+    char text[http_date::fixdate_length] = {};
+
+    http_cached_date() = default;
+
+    explicit http_cached_date(std::time_t value)
+        : time(value)
+    {
+        http_date::parts parts{};
+        char* dst = text;
+        date_converter<http_date, std::time_t>::to_parts(value, parts);
+        http_date::write<trusted_validation>(parts, dst);
+    }
+
+    std::string str() const
+    {
+        return std::string(text, http_date::fixdate_length);
+    }
+};
+
+// ----------------------------------------------------------------------------
+//! Evaluates If-Modified-Since (RFC 7232, section 3.3) against a cached
+//  Last-Modified: returns true when the resource has not been modified.
+//  Clients usually echo the validator back byte for byte, which is answered
+//  by one comparison; other values are parsed as any HTTP-date (surrounded by
+//  optional whitespace). Values which cannot be parsed, including ones with
+//  trailing data, are ignored (the resource is reported as modified).
+template <class Policy = strict_validation>
+bool is_not_modified_since(const char* since, std::size_t size, const http_cached_date& last_modified)
+{
+    if (size == http_date::fixdate_length && std::memcmp(since, last_modified.text, http_date::fixdate_length) == 0)
+        return true;
+
+    const char* end = since + size;
+    while (end != since && (end[-1] == ' ' || end[-1] == '\t'))
+        --end;
+
+    http_date::parts parts{};
+    std::time_t since_time{};
+    const char* pos = since;
+    if (!http_date::read<Policy>(pos, end, parts) || pos != end || !date_converter<http_date, std::time_t>::from_parts(parts, since_time))
+        return false;
+
+    return (last_modified.time <= since_time);
+}
+
+// ----------------------------------------------------------------------------
+template <class Policy = strict_validation>
+bool is_not_modified_since(const std::string& since, const http_cached_date& last_modified)
+{
+    return is_not_modified_since<Policy>(since.data(), since.size(), last_modified);
+}
+
+} // namespace date
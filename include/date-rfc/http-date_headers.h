@@ -0,0 +1,160 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#include <cstddef>
+#include <ctime>
+#include "details/byte_scanner.h"
+#include "http-date_type.h"
+#include "http-date_converter.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                            http date headers
+// ----------------------------------------------------------------------------
+//! Date-valued fields of an HTTP header block.
+struct http_date_headers
+{
+    enum field : unsigned
+    {
+        date = 0,
+        last_modified,
+        expires,
+        if_modified_since,
+        field_count,
+    };
+
+    std::time_t values[field_count] = {};
+    unsigned found = 0;     //!< bit (1 << field) is set when the field holds a valid date
+    unsigned malformed = 0; //!< bit (1 << field) is set when the field is present but invalid
+
+    bool has(field name) const
+    {
+        return (found & (1u << name)) != 0;
+    }
+};
+
+// ----------------------------------------------------------------------------
+//! Scans a raw header block ('Name: value' lines separated by CRLF or LF) in
+//  one pass: colons and line feeds are located by a vector search, names are
+//  compared case-insensitively and only the values of Date, Last-Modified,
+//  Expires and If-Modified-Since are parsed. Scanning stops at the empty line
+//  which ends the block. Returns the 'found' mask.
+template <class Policy = strict_validation>
+unsigned scan_http_date_headers(const char* data, std::size_t size, http_date_headers& headers)
+{
+    struct field_name
+    {
+        const char* name;
+        std::size_t length;
+        http_date_headers::field field;
+    };
+
+    static const field_name names[] = {
+        { "date",              4,  http_date_headers::date },
+        { "expires",           7,  http_date_headers::expires },
+        { "last-modified",     13, http_date_headers::last_modified },
+        { "if-modified-since", 17, http_date_headers::if_modified_since },
+    };
+
+    const auto is_name = [](const char* begin, const char* end, const field_name& name) {
+        if (static_cast<std::size_t>(end - begin) != name.length)
+            return false;
+        for (std::size_t i = 0; i < name.length; ++i)
+        {
+            const char ch = begin[i];
+            const char lower = (ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch - 'A' + 'a') : ch;
+            if (lower != name.name[i])
+                return false;
+        }
+        return true;
+    };
+
+    headers = http_date_headers{};
+    const char* pos = data;
+    const char* const end = data + size;
+    while (pos != end)
+    {
+        const char* line = pos;
+        if (*line == '\n' || (*line == '\r' && line + 1 != end && line[1] == '\n'))
+            break;
+
+        const char* stop = byte_scanner::find_either(line, end, ':', '\n');
+        if (stop == end)
+            break;
+
+        if (*stop == '\n')
+        {
+            //! Not a field line.
+            pos = stop + 1;
+            continue;
+        }
+
+        const char* line_end = byte_scanner::find(stop, end, '\n');
+        pos = (line_end != end) ? line_end + 1 : end;
+        if (*line == ' ' || *line == '\t')
+        {
+            //! Obsolete line folding, continuation of the previous field.
+            continue;
+        }
+
+        const char* value = stop + 1;
+        const field_name* matched = nullptr;
+        for (const auto& name : names)
+        {
+            if (is_name(line, stop, name))
+            {
+                matched = &name;
+                break;
+            }
+        }
+        if (matched == nullptr)
+            continue;
+
+        const char* value_end = line_end;
+        while (value_end != value && (value_end[-1] == '\r' || value_end[-1] == ' ' || value_end[-1] == '\t'))
+            --value_end;
+        while (value != value_end && (*value == ' ' || *value == '\t'))
+            ++value;
+
+        const unsigned bit = 1u << matched->field;
+        http_date::parts parts{};
+        const char* value_pos = value;
+        if (http_date::read<Policy>(value_pos, value_end, parts) && value_pos == value_end &&
+            date_converter<http_date, std::time_t>::from_parts(parts, headers.values[matched->field]))
+        {
+            headers.found |= bit;
+            headers.malformed &= ~bit;
+        }
+        else if ((headers.found & bit) == 0)
+        {
+            headers.malformed |= bit;
+        }
+    }
+    return headers.found;
+}
+
+} // namespace date
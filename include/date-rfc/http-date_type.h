@@ -0,0 +1,334 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cctype>
+#include <ctime>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include "details/static_string.h"
+#include "details/iterator_traits.h"
+#include "details/calendar_helper.h"
+#include "details/fmt_common.h"
+#include "details/validation_policy.h"
+#include "rfc-1123_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                                 http date
+// ----------------------------------------------------------------------------
+//! HTTP-date of RFC 7231 (section 7.1.1.1): IMF-fixdate together with the
+//  obsolete RFC 850 and asctime forms. The form is chosen by the character
+//  which follows the 3-letter day name, so the input is read in one pass.
+//  Values are always written as IMF-fixdate.
+struct http_date
+{
+    using year_type     = rfc1123::year_type;
+    using month_type    = rfc1123::month_type;
+    using day_type      = rfc1123::day_type;
+    using week_day_type = rfc1123::week_day_type;
+    using hour_type     = rfc1123::hour_type;
+    using minute_type   = rfc1123::minute_type;
+    using second_type   = rfc1123::second_type;
+    using offset_type   = rfc1123::offset_type;
+    using parts         = rfc1123::parts;
+
+    enum : std::size_t { fixdate_length = 29 }; //!< 'Sun, 06 Nov 1994 08:49:37 GMT'
+
+    template <class Policy = strict_validation>
+    static bool validate(const parts& dt)
+    {
+        return rfc1123::validate<Policy>(dt);
+    }
+
+    template <class Char>
+    static constexpr std::array<std::pair<static_string<Char, 10>, uint8_t>, 7> weekday_full_names()
+    {
+        using string = static_string<Char, 10>;
+        return {
+            std::make_pair(string("Monday"),    uint8_t(1)),
+            std::make_pair(string("Tuesday"),   uint8_t(2)),
+            std::make_pair(string("Wednesday"), uint8_t(3)),
+            std::make_pair(string("Thursday"),  uint8_t(4)),
+            std::make_pair(string("Friday"),    uint8_t(5)),
+            std::make_pair(string("Saturday"),  uint8_t(6)),
+            std::make_pair(string("Sunday"),    uint8_t(7)),
+        };
+    }
+
+    //! Two-digit years of RFC 850 dates are the most recent years with the same
+    //  last digits which are not more than 50 years in the future.
+    static year_type expand_year(year_type year, year_type current_year)
+    {
+        int expanded = current_year - current_year % 100 + year;
+        if (expanded > current_year + 50)
+            expanded -= 100;
+        else if (expanded <= current_year - 50)
+            expanded += 100;
+        return static_cast<year_type>(expanded);
+    }
+
+    //! Year (UTC) which two-digit years are expanded against. The year and
+    //  its bounds are cached per thread and computed again only when the
+    //  current time leaves them.
+    static year_type current_year()
+    {
+        struct year_cache
+        {
+            year_type   year = 0;
+            std::time_t start = 0;
+            std::time_t next_start = 0;
+        };
+        static thread_local year_cache cache;
+
+        const std::time_t now = std::time(nullptr);
+        if (now < cache.start || now >= cache.next_start)
+        {
+            using date_time = calendar_helper::date_time;
+            const auto epoch_offset = calendar_helper::to_seconds_count(date_time{ 1970, 1, 1, 0, 0, 0 });
+            cache.year = calendar_helper::from_seconds_count(epoch_offset + now).year;
+            cache.start = static_cast<std::time_t>(calendar_helper::to_seconds_count(date_time{ cache.year, 1, 1, 0, 0, 0 }) - epoch_offset);
+            cache.next_start = static_cast<std::time_t>(calendar_helper::to_seconds_count(date_time{ static_cast<year_type>(cache.year + 1), 1, 1, 0, 0, 0 }) - epoch_offset);
+        }
+        return cache.year;
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool read(Iterator& pos, const Iterator& end, parts& value)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        using is_contiguous = typename is_contiguous_iterator<Iterator>::type;
+        constexpr auto weekday_aliases = rfc1123::weekday_names<char_type>();
+
+        pos = skip_spaces(pos, end);
+        if (pos == end)
+            return false;
+
+        parts dt{};
+        std::memset(static_cast<void*>(&dt), 0, sizeof(parts));
+
+        if (!read_fixdate(pos, end, dt, is_contiguous{}))
+        {
+            auto day_name = format(aliases(dt.week_day, weekday_aliases));
+            if (!::date::read(pos, end, day_name) || pos == end)
+                return false;
+
+            const char_type ch = *pos;
+            const bool is_read = (ch == char_type{ ',' }) ? read_imf_fixdate(pos, end, dt)
+                : (ch == char_type{ ' ' }) ? read_asctime(pos, end, dt)
+                : read_rfc850(pos, end, dt);
+            if (!is_read)
+                return false;
+        }
+
+        if (!validate<Policy>(dt))
+            return false;
+
+        value = dt;
+        return true;
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool validate_only(Iterator& pos, const Iterator& end)
+    {
+        parts dt{};
+        return read<Policy>(pos, end, dt);
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool write(const parts& dt, Iterator& dst)
+    {
+        //! Senders must generate IMF-fixdate which is the GMT form of RFC 1123.
+        return rfc1123::write<Policy>(dt, dst);
+    }
+
+private:
+    template <class Char>
+    static bool is_digit(Char ch)
+    {
+        return (ch >= Char{ '0' }) && (ch <= Char{ '9' });
+    }
+
+    template <class Char>
+    static unsigned decode_digits(const Char* str, std::size_t count)
+    {
+        unsigned value = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (!is_digit(str[i]))
+                return static_cast<unsigned>(-1);
+            value = 10 * value + static_cast<unsigned>(str[i] - Char{ '0' });
+        }
+        return value;
+    }
+
+    template <class Char, class Aliases>
+    static uint8_t decode_alias(const Char* str, const Aliases& aliases)
+    {
+        for (const auto& alias : aliases)
+        {
+            if (str[0] == alias.first[0] && str[1] == alias.first[1] && str[2] == alias.first[2])
+                return alias.second;
+        }
+        return 0;
+    }
+
+    //! Fixed-layout fast path for 'Sun, 06 Nov 1994 08:49:37 GMT' when the
+    //  input can be addressed directly. Returns false if the input does not
+    //  have this exact layout, the general reader then decides.
+    template <class Iterator>
+    static bool read_fixdate(Iterator& pos, const Iterator& end, parts& dt, std::true_type)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        constexpr auto weekday_aliases = rfc1123::weekday_names<char_type>();
+        constexpr auto month_aliases = rfc1123::month_names<char_type>();
+
+        if (end - pos < static_cast<typename std::iterator_traits<Iterator>::difference_type>(fixdate_length))
+            return false;
+
+        const char_type* str = &*pos;
+        if (str[3]  != char_type{ ',' } || str[4]  != char_type{ ' ' } || str[7]  != char_type{ ' ' } ||
+            str[11] != char_type{ ' ' } || str[16] != char_type{ ' ' } || str[19] != char_type{ ':' } ||
+            str[22] != char_type{ ':' } || str[25] != char_type{ ' ' } || str[26] != char_type{ 'G' } ||
+            str[27] != char_type{ 'M' } || str[28] != char_type{ 'T' })
+            return false;
+
+        const auto week_day = decode_alias(str, weekday_aliases);
+        const auto month = decode_alias(str + 8, month_aliases);
+        const auto day = decode_digits(str + 5, 2);
+        const auto year = decode_digits(str + 12, 4);
+        const auto hour = decode_digits(str + 17, 2);
+        const auto minute = decode_digits(str + 20, 2);
+        const auto second = decode_digits(str + 23, 2);
+        if (week_day == 0 || month == 0 || ((day | year | hour | minute | second) > 0xFFFF))
+            return false;
+
+        dt.week_day = week_day;
+        dt.day      = static_cast<day_type>(day);
+        dt.month    = month;
+        dt.year     = static_cast<year_type>(year);
+        dt.hour     = static_cast<hour_type>(hour);
+        dt.minute   = static_cast<minute_type>(minute);
+        dt.second   = static_cast<second_type>(second);
+        pos += fixdate_length;
+        return true;
+    }
+
+    template <class Iterator>
+    static bool read_fixdate(Iterator&, const Iterator&, parts&, std::false_type)
+    {
+        return false;
+    }
+
+    //! ', 06 Nov 1994 08:49:37 GMT'
+    template <class Iterator>
+    static bool read_imf_fixdate(Iterator& pos, const Iterator& end, parts& dt)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        constexpr auto month_aliases = rfc1123::month_names<char_type>();
+
+        auto fmt = format(
+            characters<char_type>(", "),
+            unsigned_integer<2, 2>(dt.day),    character<char_type>(' '),
+            aliases(dt.month, month_aliases),  character<char_type>(' '),
+            unsigned_integer<4, 4>(dt.year),   character<char_type>(' '),
+            unsigned_integer<2, 2>(dt.hour),   character<char_type>(':'),
+            unsigned_integer<2, 2>(dt.minute), character<char_type>(':'),
+            unsigned_integer<2, 2>(dt.second), character<char_type>(' '),
+            characters<char_type>("GMT"));
+        return ::date::read(pos, end, fmt);
+    }
+
+    //! 'day, 06-Nov-94 08:49:37 GMT' (rest of the full day name first)
+    template <class Iterator>
+    static bool read_rfc850(Iterator& pos, const Iterator& end, parts& dt)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        constexpr auto weekday_full_aliases = weekday_full_names<char_type>();
+        constexpr auto month_aliases = rfc1123::month_names<char_type>();
+
+        const auto& full_name = weekday_full_aliases[dt.week_day - 1].first;
+        for (std::size_t i = 3; i < full_name.length(); ++i, ++pos)
+        {
+            if (pos == end || *pos != full_name[i])
+                return false;
+        }
+
+        auto fmt = format(
+            characters<char_type>(", "),
+            unsigned_integer<2, 2>(dt.day),    character<char_type>('-'),
+            aliases(dt.month, month_aliases),  character<char_type>('-'),
+            unsigned_integer<2, 2>(dt.year),   character<char_type>(' '),
+            unsigned_integer<2, 2>(dt.hour),   character<char_type>(':'),
+            unsigned_integer<2, 2>(dt.minute), character<char_type>(':'),
+            unsigned_integer<2, 2>(dt.second), character<char_type>(' '),
+            characters<char_type>("GMT"));
+        if (!::date::read(pos, end, fmt))
+            return false;
+
+        dt.year = expand_year(dt.year, current_year());
+        return true;
+    }
+
+    //! ' Nov  6 08:49:37 1994'
+    template <class Iterator>
+    static bool read_asctime(Iterator& pos, const Iterator& end, parts& dt)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        constexpr auto month_aliases = rfc1123::month_names<char_type>();
+
+        auto month = format(
+            character<char_type>(' '),
+            aliases(dt.month, month_aliases),  character<char_type>(' '));
+        if (!::date::read(pos, end, month) || pos == end)
+            return false;
+
+        if (*pos == char_type{ ' ' })
+        {
+            auto day = format(character<char_type>(' '), unsigned_integer<1, 1>(dt.day));
+            if (!::date::read(pos, end, day))
+                return false;
+        }
+        else
+        {
+            auto day = format(unsigned_integer<2, 2>(dt.day));
+            if (!::date::read(pos, end, day))
+                return false;
+        }
+
+        auto fmt = format(
+            character<char_type>(' '),
+            unsigned_integer<2, 2>(dt.hour),   character<char_type>(':'),
+            unsigned_integer<2, 2>(dt.minute), character<char_type>(':'),
+            unsigned_integer<2, 2>(dt.second), character<char_type>(' '),
+            unsigned_integer<4, 4>(dt.year));
+        return ::date::read(pos, end, fmt);
+    }
+};
+
+} // namespace date
@@ -0,0 +1,127 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+#include "details/validation_policy.h"
+#include "iso-8601_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                              iso8601 reader
+// ----------------------------------------------------------------------------
+//! Reads records of one source (a stream, a file, a column) which usually
+//  share one layout. The layout is detected on the first record and then is
+//  read by the fixed decoder of iso8601::read_layout(). It is detected again
+//  only when a record does not match: forward iterators are rewound for it,
+//  input iterators can not be rewound, so the record fails and the layout is
+//  detected again on the next read.
+template <class Policy = strict_validation>
+class iso8601_reader
+{
+public:
+    using layout_type = iso8601::layout_type;
+    using parts = iso8601::parts;
+
+    iso8601_reader() = default;
+
+    explicit iso8601_reader(layout_type layout)
+        : m_layout(layout)
+    {}
+
+    layout_type layout() const
+    {
+        return m_layout;
+    }
+
+    //! Count of layout detections, which is 1 for a uniform source.
+    std::size_t detections() const
+    {
+        return m_detections;
+    }
+
+    void reset()
+    {
+        m_layout = iso8601::unknown_layout;
+        m_detections = 0;
+    }
+
+    template <class Iterator>
+    bool read(Iterator& pos, const Iterator& end, parts& value)
+    {
+        using category = typename std::iterator_traits<Iterator>::iterator_category;
+        return read(pos, end, value, std::is_base_of<std::forward_iterator_tag, category>());
+    }
+
+private:
+    template <class Iterator>
+    bool read(Iterator& pos, const Iterator& end, parts& value, std::true_type)
+    {
+        if (m_layout != iso8601::unknown_layout)
+        {
+            Iterator it = pos;
+            if (iso8601::read_layout<Policy>(m_layout, it, end, value))
+            {
+                pos = it;
+                return true;
+            }
+        }
+        return detect(pos, end, value);
+    }
+
+    template <class Iterator>
+    bool read(Iterator& pos, const Iterator& end, parts& value, std::false_type)
+    {
+        if (m_layout == iso8601::unknown_layout)
+            return detect(pos, end, value);
+
+        if (iso8601::read_layout<Policy>(m_layout, pos, end, value))
+            return true;
+
+        m_layout = iso8601::unknown_layout;
+        return false;
+    }
+
+    template <class Iterator>
+    bool detect(Iterator& pos, const Iterator& end, parts& value)
+    {
+        layout_type layout = iso8601::unknown_layout;
+        if (!iso8601::read_detect<Policy>(pos, end, value, layout))
+            return false;
+
+        m_layout = layout;
+        ++m_detections;
+        return true;
+    }
+
+private:
+    layout_type m_layout = iso8601::unknown_layout;
+    std::size_t m_detections = 0;
+};
+
+} // namespace date
@@ -0,0 +1,471 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cctype>
+#include <ctime>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include "details/iterator_traits.h"
+#include "details/calendar_helper.h"
+#include "details/data_writers.h"
+#include "details/fmt_common.h"
+#include "details/validation_policy.h"
+#include "rfc-3339_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                                  iso8601
+// ----------------------------------------------------------------------------
+//! ISO 8601 date and time of day in basic and extended formats with calendar,
+//  ordinal and week dates. The time part is optional, it is separated by 'T',
+//  't' or (in extended format) by a space and follows the format of the date.
+//  A date without a zone designator is taken as UTC.
+//
+//  The layout is recognized by look-ahead of one character and by counting
+//  digits, so input is never read twice. Once a layout is known it may be
+//  read directly by read_layout(), see iso8601_reader.
+struct iso8601
+{
+    using year_type    = rfc3339::year_type;
+    using month_type   = rfc3339::month_type;
+    using day_type     = rfc3339::day_type;
+    using hour_type    = rfc3339::hour_type;
+    using minute_type  = rfc3339::minute_type;
+    using second_type  = rfc3339::second_type;
+    using nanosec_type = rfc3339::nanosec_type;
+    using offset_type  = rfc3339::offset_type;
+    using week_type    = uint8_t;
+    using ordinal_type = uint16_t;
+    using parts        = rfc3339::parts;
+
+    enum layout_type : uint8_t
+    {
+        unknown_layout    = 0,
+        calendar_extended = 1,  //!< 2010-12-31T23:59:59Z
+        calendar_basic    = 2,  //!< 20101231T235959Z
+        ordinal_extended  = 3,  //!< 2010-365T23:59:59Z
+        ordinal_basic     = 4,  //!< 2010365T235959Z
+        week_extended     = 5,  //!< 2010-W52-5T23:59:59Z
+        week_basic        = 6,  //!< 2010W525T235959Z
+    };
+
+    static bool is_extended(layout_type layout)
+    {
+        return (layout == calendar_extended || layout == ordinal_extended || layout == week_extended);
+    }
+
+    template <class Policy = strict_validation>
+    static bool validate(const parts& dt)
+    {
+        return rfc3339::validate<Policy>(dt);
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool read(Iterator& pos, const Iterator& end, parts& value)
+    {
+        layout_type layout = unknown_layout;
+        return read_detect<Policy>(pos, end, value, layout);
+    }
+
+    //! Reads the value of any layout and reports the layout which was found.
+    template <class Policy = strict_validation, class Iterator>
+    static bool read_detect(Iterator& pos, const Iterator& end, parts& value, layout_type& layout)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        pos = skip_spaces(pos, end);
+
+        parts dt{};
+        std::memset(static_cast<void*>(&dt), 0, sizeof(parts));
+
+        unsigned number = 0;
+        std::size_t digits = 0;
+        if (!read_digits(pos, end, 4, 4, number, digits) || pos == end)
+            return false;
+
+        const year_type year = static_cast<year_type>(number);
+        layout_type detected = unknown_layout;
+        if (*pos == char_type{ '-' })
+        {
+            ++pos;
+            if (pos != end && *pos == char_type{ 'W' })
+            {
+                detected = week_extended;
+                if (!read_week<Policy>(true, pos, end, year, dt))
+                    return false;
+            }
+            else
+            {
+                if (!read_digits(pos, end, 2, 3, number, digits))
+                    return false;
+
+                if (digits == 3)
+                {
+                    detected = ordinal_extended;
+                    if (!from_ordinal<Policy>(year, static_cast<ordinal_type>(number), dt))
+                        return false;
+                }
+                else
+                {
+                    detected = calendar_extended;
+                    dt.year = year;
+                    dt.month = static_cast<month_type>(number);
+                    if (pos == end || *pos != char_type{ '-' })
+                        return false;
+                    ++pos;
+                    if (!read_digits(pos, end, 2, 2, number, digits))
+                        return false;
+                    dt.day = static_cast<day_type>(number);
+                }
+            }
+        }
+        else if (*pos == char_type{ 'W' })
+        {
+            detected = week_basic;
+            if (!read_week<Policy>(false, pos, end, year, dt))
+                return false;
+        }
+        else
+        {
+            if (!read_digits(pos, end, 3, 4, number, digits))
+                return false;
+
+            if (digits == 3)
+            {
+                detected = ordinal_basic;
+                if (!from_ordinal<Policy>(year, static_cast<ordinal_type>(number), dt))
+                    return false;
+            }
+            else
+            {
+                detected = calendar_basic;
+                dt.year = year;
+                dt.month = static_cast<month_type>(number / 100);
+                dt.day = static_cast<day_type>(number % 100);
+            }
+        }
+
+        if (!read_time<Policy>(is_extended(detected), pos, end, dt) || !validate<Policy>(dt))
+            return false;
+
+        layout = detected;
+        value = dt;
+        return true;
+    }
+
+    //! Reads the value of the given layout only, without any look-ahead to
+    //  choose the form of the date.
+    template <class Policy = strict_validation, class Iterator>
+    static bool read_layout(layout_type layout, Iterator& pos, const Iterator& end, parts& value)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        pos = skip_spaces(pos, end);
+
+        parts dt{};
+        std::memset(static_cast<void*>(&dt), 0, sizeof(parts));
+
+        ordinal_type ordinal = 0;
+        week_type week = 0;
+        day_type week_day = 0;
+        bool is_read = false;
+        switch (layout)
+        {
+        case calendar_extended:
+            {
+                auto fmt = format(
+                    unsigned_integer<4, 4>(dt.year),  character<char_type>('-'),
+                    unsigned_integer<2, 2>(dt.month), character<char_type>('-'),
+                    unsigned_integer<2, 2>(dt.day));
+                is_read = ::date::read(pos, end, fmt);
+            }
+            break;
+        case calendar_basic:
+            {
+                auto fmt = format(
+                    unsigned_integer<4, 4>(dt.year),
+                    unsigned_integer<2, 2>(dt.month),
+                    unsigned_integer<2, 2>(dt.day));
+                is_read = ::date::read(pos, end, fmt);
+            }
+            break;
+        case ordinal_extended:
+            {
+                auto fmt = format(
+                    unsigned_integer<4, 4>(dt.year), character<char_type>('-'),
+                    unsigned_integer<3, 3>(ordinal));
+                is_read = ::date::read(pos, end, fmt) && from_ordinal<Policy>(dt.year, ordinal, dt);
+            }
+            break;
+        case ordinal_basic:
+            {
+                auto fmt = format(
+                    unsigned_integer<4, 4>(dt.year),
+                    unsigned_integer<3, 3>(ordinal));
+                is_read = ::date::read(pos, end, fmt) && from_ordinal<Policy>(dt.year, ordinal, dt);
+            }
+            break;
+        case week_extended:
+            {
+                auto fmt = format(
+                    unsigned_integer<4, 4>(dt.year), character<char_type>('-'),
+                    character<char_type>('W'),       unsigned_integer<2, 2>(week),
+                    character<char_type>('-'),       unsigned_integer<1, 1>(week_day));
+                is_read = ::date::read(pos, end, fmt) && from_week<Policy>(dt.year, week, week_day, dt);
+            }
+            break;
+        case week_basic:
+            {
+                auto fmt = format(
+                    unsigned_integer<4, 4>(dt.year),
+                    character<char_type>('W'),       unsigned_integer<2, 2>(week),
+                    unsigned_integer<1, 1>(week_day));
+                is_read = ::date::read(pos, end, fmt) && from_week<Policy>(dt.year, week, week_day, dt);
+            }
+            break;
+        default:
+            break;
+        }
+
+        if (!is_read || !read_time<Policy>(is_extended(layout), pos, end, dt) || !validate<Policy>(dt))
+            return false;
+
+        value = dt;
+        return true;
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool write(const parts& dt, Iterator& dst)
+    {
+        return rfc3339::write<Policy>(dt, dst);
+    }
+
+    //! Converts an ordinal date (day of the year) to a calendar date.
+    template <class Policy = strict_validation>
+    static bool from_ordinal(year_type year, ordinal_type ordinal, parts& dt)
+    {
+        if (Policy::check_ranges && (ordinal == 0 || ordinal > 366))
+            return false;
+        if (Policy::check_calendar && ordinal > days_in_year(year))
+            return false;
+
+        month_type month = 1;
+        for (; month < 12 && ordinal > calendar_helper::days_in_month(year, month); ++month)
+            ordinal = static_cast<ordinal_type>(ordinal - calendar_helper::days_in_month(year, month));
+
+        dt.year = year;
+        dt.month = month;
+        dt.day = static_cast<day_type>(ordinal);
+        return true;
+    }
+
+    //! Converts a week date to a calendar date, the first week of a year is
+    //  the week with the first Thursday of the year.
+    template <class Policy = strict_validation>
+    static bool from_week(year_type year, week_type week, day_type week_day, parts& dt)
+    {
+        if (Policy::check_ranges && (week == 0 || week > 53 || week_day == 0 || week_day > 7))
+            return false;
+        if (Policy::check_calendar && week > weeks_in_year(year))
+            return false;
+
+        const int jan4_week_day = calendar_helper::day_of_week(calendar_helper::date{ year, 1, 4 });
+        int ordinal = 7 * week + week_day - (jan4_week_day + 3);
+        if (ordinal < 1)
+        {
+            year = static_cast<year_type>(year - 1);
+            ordinal += days_in_year(year);
+        }
+        else if (ordinal > days_in_year(year))
+        {
+            ordinal -= days_in_year(year);
+            year = static_cast<year_type>(year + 1);
+        }
+        return from_ordinal<trusted_validation>(year, static_cast<ordinal_type>(ordinal), dt);
+    }
+
+    static ordinal_type days_in_year(year_type year)
+    {
+        return calendar_helper::is_leap_year(year) ? 366 : 365;
+    }
+
+    static week_type weeks_in_year(year_type year)
+    {
+        //! A year has 53 weeks when it starts on Thursday or when it is a
+        //  leap year starting on Wednesday.
+        const auto jan1_week_day = calendar_helper::day_of_week(calendar_helper::date{ year, 1, 1 });
+        if (jan1_week_day == calendar_helper::Thursday)
+            return 53;
+        if (jan1_week_day == calendar_helper::Wednesday && calendar_helper::is_leap_year(year))
+            return 53;
+        return 52;
+    }
+
+private:
+    template <class Char>
+    static bool is_digit(Char ch)
+    {
+        return (ch >= Char{ '0' }) && (ch <= Char{ '9' });
+    }
+
+    template <class Iterator>
+    static bool read_digits(Iterator& pos, const Iterator& end, std::size_t min, std::size_t max, unsigned& value, std::size_t& digits)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        value = 0;
+        digits = 0;
+        for (; pos != end && digits < max; ++pos, ++digits)
+        {
+            const char_type ch = *pos;
+            if (!is_digit(ch))
+                break;
+            value = 10 * value + static_cast<unsigned>(ch - char_type{ '0' });
+        }
+        return (digits >= min);
+    }
+
+    //! Reads 'Www-D' or 'WwwD' after the year.
+    template <class Policy, class Iterator>
+    static bool read_week(bool extended, Iterator& pos, const Iterator& end, year_type year, parts& dt)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        unsigned week = 0;
+        unsigned week_day = 0;
+        std::size_t digits = 0;
+
+        ++pos;
+        if (!read_digits(pos, end, 2, 2, week, digits))
+            return false;
+        if (extended)
+        {
+            if (pos == end || *pos != char_type{ '-' })
+                return false;
+            ++pos;
+        }
+        if (!read_digits(pos, end, 1, 1, week_day, digits))
+            return false;
+
+        return from_week<Policy>(year, static_cast<week_type>(week), static_cast<day_type>(week_day), dt);
+    }
+
+    //! Reads the optional time of day with the fraction of the second and
+    //  the zone designator. A digit right after the date is an error: it
+    //  means that the date has another layout.
+    template <class Policy, class Iterator>
+    static bool read_time(bool extended, Iterator& pos, const Iterator& end, parts& dt)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        if (pos == end)
+            return true;
+
+        const char_type separator = *pos;
+        if (is_digit(separator))
+            return false;
+        if (separator != char_type{ 'T' } && separator != char_type{ 't' } && !(extended && separator == char_type{ ' ' }))
+            return true;
+        ++pos;
+
+        unsigned number = 0;
+        std::size_t digits = 0;
+        if (!read_digits(pos, end, 2, 2, number, digits))
+            return false;
+        dt.hour = static_cast<hour_type>(number);
+
+        if (extended && !read_separator(pos, end, char_type{ ':' }))
+            return false;
+        if (!read_digits(pos, end, 2, 2, number, digits))
+            return false;
+        dt.minute = static_cast<minute_type>(number);
+
+        if (pos != end && (extended ? (*pos == char_type{ ':' }) : is_digit(*pos)))
+        {
+            if (extended)
+                ++pos;
+            if (!read_digits(pos, end, 2, 2, number, digits))
+                return false;
+            dt.second = static_cast<second_type>(number);
+        }
+
+        if (pos != end && (*pos == char_type{ '.' } || *pos == char_type{ ',' }))
+        {
+            ++pos;
+            auto secfrac = format(fraction<9>(dt.nanosecond));
+            if (!::date::read(pos, end, secfrac))
+                return false;
+        }
+
+        if (pos == end)
+            return true;
+
+        const char_type sign = *pos;
+        if (sign == char_type{ 'Z' } || sign == char_type{ 'z' })
+        {
+            ++pos;
+        }
+        else if (sign == char_type{ '+' } || sign == char_type{ '-' })
+        {
+            ++pos;
+            unsigned offset_hours = 0;
+            unsigned offset_minutes = 0;
+            if (!read_digits(pos, end, 2, 2, offset_hours, digits))
+                return false;
+            if (pos != end && *pos == char_type{ ':' })
+            {
+                ++pos;
+                if (!read_digits(pos, end, 2, 2, offset_minutes, digits))
+                    return false;
+            }
+            else if (pos != end && is_digit(*pos))
+            {
+                if (!read_digits(pos, end, 2, 2, offset_minutes, digits))
+                    return false;
+            }
+            if (Policy::check_ranges && (offset_hours > 23 || offset_minutes > 59))
+                return false;
+
+            const auto offset = static_cast<offset_type>(offset_hours * 60 + offset_minutes);
+            dt.offset_in_minutes = (sign == char_type{ '-' }) ? static_cast<offset_type>(-offset) : offset;
+        }
+        return true;
+    }
+
+    template <class Iterator, class Char>
+    static bool read_separator(Iterator& pos, const Iterator& end, Char ch)
+    {
+        if (pos == end || *pos != ch)
+            return false;
+        ++pos;
+        return true;
+    }
+};
+
+} // namespace date
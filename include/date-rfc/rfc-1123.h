@@ -26,3 +26,5 @@
 #include "rfc-1123_type.h"
 #include "rfc-1123_converter.h"
 #include "rfc-1123_formatter.h"
+#include "date_validator.h"
+#include "date_push_parser.h"
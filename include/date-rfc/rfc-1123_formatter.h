@@ -32,10 +32,10 @@ namespace date
 {
 
 // ----------------------------------------------------------------------------
-template <class Date, class Converter = date_converter<rfc1123, Date>>
-format_rfc<rfc1123, Date> format_rfc1123(Date& value, const rfc1123& format = rfc1123())
+template <class Date, class Converter = date_converter<rfc1123, Date>, class Policy = strict_validation>
+format_rfc<rfc1123, Date, Converter, Policy> format_rfc1123(Date& value, const rfc1123& format = rfc1123())
 {
-    return format_rfc<rfc1123, Date, Converter>(value, format);
+    return format_rfc<rfc1123, Date, Converter, Policy>(value, format);
 }
 
 } // namespace date
@@ -33,6 +33,7 @@
 #include "details/calendar_helper.h"
 #include "details/data_writers.h"
 #include "details/fmt_common.h"
+#include "details/validation_policy.h"
 
 // ----------------------------------------------------------------------------
 namespace date
@@ -64,28 +65,39 @@ struct rfc1123
         offset_type   offset_in_minutes = 0; //!< [-6039 .. 6039] (due to format '(+|-)HHMM')
     };
 
-    static bool validate(const parts& dt)
+    template <class Policy = strict_validation>
+    static DATE_RFC_CONSTEXPR14 bool validate(const parts& dt)
     {
-        if (dt.year == 0)
-            return false;
-        if (dt.month == 0 || dt.month > 12)
-            return false;
-        if (dt.day == 0 || dt.day > calendar_helper::days_in_month(dt.year, dt.month))
-            return false;
-        if (dt.hour > 23)
-            return false;
-        if (dt.minute > 59)
-            return false;
-        if (dt.second > 59)
-            return false;
-        if (std::abs(dt.offset_in_minutes) > 6039)
-            return false;
-        if (dt.week_day != 0)
+        if (Policy::check_ranges)
         {
-            const auto week_day = calendar_helper::day_of_week(calendar_helper::date{ dt.year, dt.month, dt.day });
-            if (dt.week_day != week_day)
+            if (dt.year == 0)
+                return false;
+            if (dt.month == 0 || dt.month > 12)
+                return false;
+            if (dt.day == 0 || dt.day > 31)
+                return false;
+            if (dt.week_day > 7)
+                return false;
+            if (dt.hour > 23)
+                return false;
+            if (dt.minute > 59)
+                return false;
+            if (dt.second > 59)
+                return false;
+            if (dt.offset_in_minutes < -6039 || dt.offset_in_minutes > 6039)
                 return false;
         }
+        if (Policy::check_calendar)
+        {
+            if (dt.day > calendar_helper::days_in_month(dt.year, dt.month))
+                return false;
+            if (dt.week_day != 0)
+            {
+                const auto week_day = calendar_helper::day_of_week(calendar_helper::date{ dt.year, dt.month, dt.day });
+                if (dt.week_day != week_day)
+                    return false;
+            }
+        }
         return true;
     }
 
@@ -144,7 +156,7 @@ struct rfc1123
         };
     }
 
-    template <class Iterator>
+    template <class Policy = strict_validation, class Iterator>
     static bool read(Iterator& pos, const Iterator& end, parts& value)
     {
         using char_type = typename iterator_traits<Iterator>::value_type;
@@ -159,8 +171,10 @@ struct rfc1123
         parts dt{};
         std::memset(static_cast<void*>(&dt), 0, sizeof(parts));
 
-        offset_type offset_hours = 0;
-        offset_type offset_minutes = 0;
+        offset_type east_hours = 0;
+        offset_type east_minutes = 0;
+        offset_type west_hours = 0;
+        offset_type west_minutes = 0;
         auto fmt = format(
             optional(
                 aliases(dt.week_day, weekday_aliases), 
@@ -178,17 +192,26 @@ struct rfc1123
                 branch(
                     aliases(dt.offset_in_minutes, zone_aliases)),
                 branch(
-                    signed_integer<2, 2, SignRequired>(offset_hours),
-                    unsigned_integer<2, 2>(offset_minutes))));
+                    character<char_type>('+'),
+                    unsigned_integer<2, 2>(east_hours),
+                    unsigned_integer<2, 2>(east_minutes)),
+                branch(
+                    character<char_type>('-'),
+                    unsigned_integer<2, 2>(west_hours),
+                    unsigned_integer<2, 2>(west_minutes))));
 
-        if (!::date::read(pos, end, fmt) || !validate(dt))
+        if (!::date::read(pos, end, fmt))
             return false;
 
         if (dt.year < 100)
             dt.year += 1900;
 
+        //! The sign is kept by branches, so '+0030' is east of UTC as well.
         if (dt.offset_in_minutes == 0)
-            dt.offset_in_minutes = offset_hours * 60 + (offset_hours > 0 ? offset_minutes : -offset_minutes);
+            dt.offset_in_minutes = static_cast<offset_type>((east_hours * 60 + east_minutes) - (west_hours * 60 + west_minutes));
+
+        if (!validate<Policy>(dt))
+            return false;
 
         if (dt.week_day == 0)
             dt.week_day = calendar_helper::day_of_week(calendar_helper::date{ dt.year, dt.month, dt.day });
@@ -197,10 +220,82 @@ struct rfc1123
         return true;
     }
 
-    template <class Iterator>
+    template <class Policy = strict_validation, class Iterator>
+    static bool validate_only(Iterator& pos, const Iterator& end)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        constexpr auto weekday_aliases = weekday_names<char_type>();
+        constexpr auto month_aliases = month_names<char_type>();
+        constexpr auto zone_aliases = zone_names<char_type>();
+
+        pos = skip_spaces(pos, end);
+        if (pos == end)
+            return false;
+
+        //! Optional parts are chosen by one look-ahead character, so nothing
+        //  is cached, the zone is not converted and no week day is derived.
+        parts dt{};
+        dt.week_day = 0;
+
+        const char_type first = *pos;
+        if (first < char_type{ '0' } || first > char_type{ '9' })
+        {
+            auto day_name = format(aliases(dt.week_day, weekday_aliases), characters<char_type>(", "));
+            if (!::date::read(pos, end, day_name))
+                return false;
+        }
+
+        auto date_time = format(
+            unsigned_integer<1, 2>(dt.day),    character<char_type>(' '),
+            aliases(dt.month, month_aliases),  character<char_type>(' '),
+            unsigned_integer<2, 4>(dt.year),   character<char_type>(' '),
+            unsigned_integer<2, 2>(dt.hour),   character<char_type>(':'),
+            unsigned_integer<2, 2>(dt.minute));
+        if (!::date::read(pos, end, date_time))
+            return false;
+
+        if (pos != end && *pos == char_type{ ':' })
+        {
+            auto seconds = format(character<char_type>(':'), unsigned_integer<2, 2>(dt.second));
+            if (!::date::read(pos, end, seconds))
+                return false;
+        }
+
+        auto separator = format(character<char_type>(' '));
+        if (!::date::read(pos, end, separator) || pos == end)
+            return false;
+
+        const char_type sign = *pos;
+        if (sign == char_type{ '+' } || sign == char_type{ '-' })
+        {
+            offset_type offset_hours = 0;
+            offset_type offset_minutes = 0;
+            auto numoffset = format(
+                character<char_type>(sign),
+                unsigned_integer<2, 2>(offset_hours),
+                unsigned_integer<2, 2>(offset_minutes));
+            if (!::date::read(pos, end, numoffset))
+                return false;
+            const auto offset = static_cast<offset_type>(offset_hours * 60 + offset_minutes);
+            dt.offset_in_minutes = (sign == char_type{ '-' }) ? static_cast<offset_type>(-offset) : offset;
+        }
+        else
+        {
+            auto zone = format(aliases(dt.offset_in_minutes, zone_aliases));
+            if (!::date::read(pos, end, zone))
+                return false;
+        }
+
+        if (dt.year < 100)
+            dt.year += 1900;
+
+        return validate<Policy>(dt);
+    }
+
+    template <class Policy = strict_validation, class Iterator>
     static bool write(const parts& dt, Iterator& dst)
     {
-        if (!validate(dt))
+        if (!validate<Policy>(dt))
             return false;
 
         using char_type = typename iterator_traits<Iterator>::value_type;
@@ -208,7 +303,8 @@ struct rfc1123
         constexpr auto month_aliases = month_names<char_type>();
         constexpr auto zone_aliases = zone_names<char_type>();
 
-        characters_writer::write(dst, weekday_aliases[dt.week_day - 1].first);
+        const week_day_type week_day = (dt.week_day != 0) ? dt.week_day : static_cast<week_day_type>(calendar_helper::day_of_week(calendar_helper::date{ dt.year, dt.month, dt.day }));
+        characters_writer::write(dst, weekday_aliases[week_day - 1].first);
         characters_writer::write(dst, char_type{ ',' });
         characters_writer::write(dst, char_type{ ' ' });
         number_writer<2>::write(dst, dt.day);
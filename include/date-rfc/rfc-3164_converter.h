@@ -0,0 +1,209 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <ctime>
+#include "details/calendar_helper.h"
+#include "date_converter.h"
+#include "rfc-3164_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                            rfc3164 year cache
+// ----------------------------------------------------------------------------
+//! Infers years of RFC 3164 timestamps relative to a reference time (usually
+//  the time of reception): the reference year is used unless the timestamp
+//  would be more than a month in the future (previous year) or more than
+//  eleven months in the past (next year). Starts of the neighbouring years
+//  are cached, so a conversion is a table lookup and a few multiplications;
+//  the calendar is recomputed only when the reference leaves its year.
+//  February 29 in an inferred non-leap year goes to the last leap year.
+//  Timestamps are taken as UTC since the format carries no time zone.
+class rfc3164_year_cache
+{
+public:
+    using year_type = rfc3164::year_type;
+
+    enum : std::time_t { future_tolerance = 31 * 24 * 60 * 60 };
+    enum : std::time_t { past_tolerance = 334 * 24 * 60 * 60 };
+
+public:
+    explicit rfc3164_year_cache(std::time_t reference = std::time(nullptr))
+    {
+        m_reference = reference;
+        cache_years(reference);
+    }
+
+    void set_reference(std::time_t reference)
+    {
+        m_reference = reference;
+        if (reference < m_yearStart[1] || reference >= m_yearStart[2])
+            cache_years(reference);
+    }
+
+    std::time_t reference() const
+    {
+        return m_reference;
+    }
+
+    //! Year which the timestamp is assumed to belong to.
+    year_type infer_year(const rfc3164::parts& dt) const
+    {
+        const std::size_t index = infer_index(dt);
+        if (is_leap_day(dt) && !m_isLeap[index])
+            return previous_leap_year(index);
+        return static_cast<year_type>(m_year - 1 + index);
+    }
+
+    bool to_time_t(const rfc3164::parts& dt, std::time_t& timepoint) const
+    {
+        if (dt.year != 0)
+        {
+            const int index = static_cast<int>(dt.year) - static_cast<int>(m_year) + 1;
+            if (index < 0 || index > 2)
+                return from_calendar(dt, dt.year, timepoint);
+            return from_cache(dt, static_cast<std::size_t>(index), timepoint);
+        }
+
+        const std::size_t index = infer_index(dt);
+        if (is_leap_day(dt) && !m_isLeap[index])
+            return from_calendar(dt, previous_leap_year(index), timepoint);
+        timepoint = seconds_since_epoch(dt, index);
+        return true;
+    }
+
+private:
+    static std::time_t epoch_offset()
+    {
+        using date_time = calendar_helper::date_time;
+        return static_cast<std::time_t>(calendar_helper::to_seconds_count(date_time{ 1970, 1, 1, 0, 0, 0 }));
+    }
+
+    static std::time_t day_of_year(const rfc3164::parts& dt, bool is_leap)
+    {
+        static const unsigned short days_before_month[12] = { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+        return days_before_month[dt.month - 1] + ((is_leap && dt.month > 2) ? 1 : 0) + dt.day - 1;
+    }
+
+    static bool is_leap_day(const rfc3164::parts& dt)
+    {
+        return dt.month == 2 && dt.day == 29;
+    }
+
+    void cache_years(std::time_t reference)
+    {
+        using date_time = calendar_helper::date_time;
+        const auto epoch = epoch_offset();
+        m_year = calendar_helper::from_seconds_count(static_cast<calendar_helper::seconds_count>(epoch + reference)).year;
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            const auto year = static_cast<year_type>(m_year - 1 + i);
+            m_yearStart[i] = static_cast<std::time_t>(calendar_helper::to_seconds_count(date_time{ year, 1, 1, 0, 0, 0 })) - epoch;
+            m_isLeap[i] = calendar_helper::is_leap_year(year);
+        }
+    }
+
+    std::time_t seconds_since_epoch(const rfc3164::parts& dt, std::size_t index) const
+    {
+        return m_yearStart[index] + day_of_year(dt, m_isLeap[index]) * 24 * 60 * 60 + dt.hour * 60 * 60 + dt.minute * 60 + dt.second;
+    }
+
+    std::size_t infer_index(const rfc3164::parts& dt) const
+    {
+        const std::time_t timepoint = seconds_since_epoch(dt, 1);
+        if (timepoint > m_reference + future_tolerance)
+            return 0;
+        if (timepoint + past_tolerance < m_reference)
+            return 2;
+        return 1;
+    }
+
+    //! Last leap year up to the inferred one (February 29 of a later one is
+    //  always beyond the future tolerance).
+    year_type previous_leap_year(std::size_t index) const
+    {
+        auto year = static_cast<year_type>(m_year - 1 + index);
+        while (!calendar_helper::is_leap_year(year))
+            --year;
+        return year;
+    }
+
+    bool from_cache(const rfc3164::parts& dt, std::size_t index, std::time_t& timepoint) const
+    {
+        if (is_leap_day(dt) && !m_isLeap[index])
+            return false;
+        timepoint = seconds_since_epoch(dt, index);
+        return true;
+    }
+
+    static bool from_calendar(const rfc3164::parts& dt, year_type year, std::time_t& timepoint)
+    {
+        using date_time = calendar_helper::date_time;
+        if (dt.day > calendar_helper::days_in_month(year, dt.month))
+            return false;
+        const auto seconds_count = calendar_helper::to_seconds_count(date_time{ year, dt.month, dt.day, dt.hour, dt.minute, dt.second });
+        timepoint = static_cast<std::time_t>(seconds_count) - epoch_offset();
+        return true;
+    }
+
+private:
+    std::time_t m_reference;
+    year_type m_year;
+    std::time_t m_yearStart[3];
+    bool m_isLeap[3];
+};
+
+// ----------------------------------------------------------------------------
+template <>
+struct date_converter<rfc3164, std::time_t, void>
+{
+    //! Infers a missing year from the current time through a per-thread cache
+    //  (refreshed only when the year changes); use rfc3164_year_cache
+    //  directly to convert against another reference time.
+    static bool from_parts(const rfc3164::parts& parts, std::time_t& timepoint)
+    {
+        static thread_local rfc3164_year_cache cache;
+        cache.set_reference(std::time(nullptr));
+        return cache.to_time_t(parts, timepoint);
+    }
+
+    static bool to_parts(std::time_t timepoint, rfc3164::parts& parts)
+    {
+        using date_time = calendar_helper::date_time;
+        const auto epoch_offset = calendar_helper::to_seconds_count(date_time{ 1970, 1, 1, 0, 0, 0 });
+        const auto dt = calendar_helper::from_seconds_count(epoch_offset + timepoint);
+        parts.year     = dt.year;
+        parts.month    = dt.month;
+        parts.day      = dt.day;
+        parts.hour     = dt.hour;
+        parts.minute   = dt.minute;
+        parts.second   = dt.second;
+        return true;
+    }
+};
+
+} // namespace date
@@ -0,0 +1,162 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cstring>
+#include <iterator>
+#include "details/iterator_traits.h"
+#include "details/calendar_helper.h"
+#include "details/data_writers.h"
+#include "details/fmt_common.h"
+#include "details/validation_policy.h"
+#include "rfc-1123_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                                  rfc3164
+// ----------------------------------------------------------------------------
+//! BSD syslog TIMESTAMP of RFC 3164 (section 4.1.2): 'Mmm dd hh:mm:ss' where
+//  a day below 10 is padded with a space. The format has neither a year nor a
+//  time zone; the year is inferred by rfc3164_year_cache on conversion.
+struct rfc3164
+{
+    using year_type     = uint16_t;
+    using month_type    = uint8_t;
+    using day_type      = uint8_t;
+    using hour_type     = uint8_t;
+    using minute_type   = uint8_t;
+    using second_type   = uint8_t;
+
+    struct parts
+    {
+        year_type     year     = 0;          //!< [0 .. 2^16-1] where 0 is 'value not defined'.
+        month_type    month    = 1;          //!< [1 .. 12]
+        day_type      day      = 1;          //!< [1 .. 31]
+        hour_type     hour     = 0;          //!< [0 .. 23]
+        minute_type   minute   = 0;          //!< [0 .. 59]
+        second_type   second   = 0;          //!< [0 .. 59]
+    };
+
+    template <class Policy = strict_validation>
+    static bool validate(const parts& dt)
+    {
+        if (Policy::check_ranges)
+        {
+            if (dt.month == 0 || dt.month > 12)
+                return false;
+            if (dt.day == 0 || dt.day > 31)
+                return false;
+            if (dt.hour > 23)
+                return false;
+            if (dt.minute > 59)
+                return false;
+            if (dt.second > 59)
+                return false;
+        }
+        if (Policy::check_calendar)
+        {
+            //! Without a year February 29 is allowed, the year check is left
+            //  to the conversion.
+            const year_type year = (dt.year != 0) ? dt.year : year_type(2000);
+            if (dt.day > calendar_helper::days_in_month(year, dt.month))
+                return false;
+        }
+        return true;
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool read(Iterator& pos, const Iterator& end, parts& value)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        constexpr auto month_aliases = rfc1123::month_names<char_type>();
+
+        pos = skip_spaces(pos, end);
+        if (pos == end)
+            return false;
+
+        parts dt{};
+        auto month = format(aliases(dt.month, month_aliases), character<char_type>(' '));
+        if (!::date::read(pos, end, month) || pos == end)
+            return false;
+
+        if (*pos == char_type{ ' ' })
+        {
+            auto day = format(character<char_type>(' '), unsigned_integer<1, 1>(dt.day));
+            if (!::date::read(pos, end, day))
+                return false;
+        }
+        else
+        {
+            auto day = format(unsigned_integer<2, 2>(dt.day));
+            if (!::date::read(pos, end, day))
+                return false;
+        }
+
+        auto time = format(
+            character<char_type>(' '),
+            unsigned_integer<2, 2>(dt.hour),   character<char_type>(':'),
+            unsigned_integer<2, 2>(dt.minute), character<char_type>(':'),
+            unsigned_integer<2, 2>(dt.second));
+        if (!::date::read(pos, end, time) || !validate<Policy>(dt))
+            return false;
+
+        value = dt;
+        return true;
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool write(const parts& dt, Iterator& dst)
+    {
+        if (!validate<Policy>(dt))
+            return false;
+
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        constexpr auto month_aliases = rfc1123::month_names<char_type>();
+
+        characters_writer::write(dst, month_aliases[dt.month - 1].first);
+        characters_writer::write(dst, char_type{ ' ' });
+        if (dt.day < 10)
+        {
+            characters_writer::write(dst, char_type{ ' ' });
+            number_writer<1>::write(dst, dt.day);
+        }
+        else
+        {
+            number_writer<2>::write(dst, dt.day);
+        }
+        characters_writer::write(dst, char_type{ ' ' });
+        number_writer<2>::write(dst, dt.hour);
+        characters_writer::write(dst, char_type{ ':' });
+        number_writer<2>::write(dst, dt.minute);
+        characters_writer::write(dst, char_type{ ':' });
+        number_writer<2>::write(dst, dt.second);
+
+        return true;
+    }
+};
+
+} // namespace date
@@ -26,3 +26,8 @@
 #include "rfc-3339_type.h"
 #include "rfc-3339_converter.h"
 #include "rfc-3339_formatter.h"
+#include "rfc-3339_view.h"
+#include "rfc-3339_canonical.h"
+#include "rfc-3339_compare.h"
+#include "date_validator.h"
+#include "date_push_parser.h"
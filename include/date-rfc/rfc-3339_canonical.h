@@ -0,0 +1,179 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "details/calendar_helper.h"
+#include "details/data_writers.h"
+#include "rfc-3339_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                           rfc3339 canonicalizer
+// ----------------------------------------------------------------------------
+//! Rewrites RFC 3339 timestamps into the canonical form
+//  'YYYY-MM-DDTHH:MM:SS[.f...]Z': UTC with a fixed count of fraction digits
+//  (extra digits are truncated). Equal instants become equal strings which
+//  are ordered and hashed as raw bytes.
+template <class Char>
+class basic_rfc3339_canonicalizer
+{
+public:
+    using char_type = Char;
+
+    enum : unsigned { max_precision = 9 };
+
+public:
+    explicit basic_rfc3339_canonicalizer(unsigned precision = max_precision)
+        : m_precision(precision < max_precision ? precision : max_precision)
+    {}
+
+    unsigned precision() const
+    {
+        return m_precision;
+    }
+
+    //! Length of canonical timestamps.
+    std::size_t length() const
+    {
+        return (m_precision == 0) ? 20 : 21 + m_precision;
+    }
+
+    //! Writes the canonical form of [src, src + size) into dst which holds
+    //  length() characters; dst may be src. Returns the written length or 0
+    //  when the source is not a valid timestamp (dst is not changed then).
+    std::size_t canonicalize(const char_type* src, std::size_t size, char_type* dst) const
+    {
+        const char_type* pos = src;
+        rfc3339::parts dt;
+        if (!rfc3339::read(pos, src + size, dt) || pos != src + size || !to_utc(dt))
+            return 0;
+
+        write(dt, dst);
+        return length();
+    }
+
+    //! Rewrites the timestamp in place: the buffer of capacity characters
+    //  starts with the timestamp of size characters.
+    std::size_t canonicalize(char_type* data, std::size_t size, std::size_t capacity) const
+    {
+        if (capacity < length())
+            return 0;
+        return canonicalize(data, size, data);
+    }
+
+    //! Rewrites count records of record_size characters stored one after
+    //  another. A record starts with the timestamp which ends at the first
+    //  padding character; the rest of a rewritten record is filled with the
+    //  padding. Invalid records are not changed. Returns the count of
+    //  rewritten records.
+    std::size_t canonicalize_records(char_type* records, std::size_t count, std::size_t record_size, char_type padding = char_type{ ' ' }) const
+    {
+        if (record_size < length())
+            return 0;
+
+        std::size_t rewritten = 0;
+        for (char_type* record = records; count != 0; --count, record += record_size)
+        {
+            std::size_t size = 0;
+            while (size < record_size && record[size] != padding)
+                ++size;
+
+            if (canonicalize(record, size, record) == 0)
+                continue;
+
+            for (std::size_t i = length(); i < record_size; ++i)
+                record[i] = padding;
+            ++rewritten;
+        }
+        return rewritten;
+    }
+
+private:
+    static bool to_utc(rfc3339::parts& dt)
+    {
+        if (dt.offset_in_minutes == 0)
+            return true;
+
+        using date_time = calendar_helper::date_time;
+        const auto first_day = calendar_helper::to_seconds_count(date_time{ 1, 1, 1, 0, 0, 0 });
+        const auto local = calendar_helper::to_seconds_count(date_time{ dt.year, dt.month, dt.day, dt.hour, dt.minute, dt.second });
+        const auto shift = static_cast<std::int64_t>(dt.offset_in_minutes) * 60;
+        if (shift > 0 && local < first_day + static_cast<calendar_helper::seconds_count>(shift))
+            return false;
+
+        const auto utc = calendar_helper::from_seconds_count(local - static_cast<calendar_helper::seconds_count>(shift));
+        if (utc.year > 9999)
+            return false;
+
+        dt.year   = utc.year;
+        dt.month  = utc.month;
+        dt.day    = utc.day;
+        dt.hour   = utc.hour;
+        dt.minute = utc.minute;
+        dt.second = utc.second;
+        dt.offset_in_minutes = 0;
+        return true;
+    }
+
+    void write(const rfc3339::parts& dt, char_type* dst) const
+    {
+        number_writer<4>::write(dst, dt.year);
+        characters_writer::write(dst, char_type{ '-' });
+        number_writer<2>::write(dst, dt.month);
+        characters_writer::write(dst, char_type{ '-' });
+        number_writer<2>::write(dst, dt.day);
+        characters_writer::write(dst, char_type{ 'T' });
+        number_writer<2>::write(dst, dt.hour);
+        characters_writer::write(dst, char_type{ ':' });
+        number_writer<2>::write(dst, dt.minute);
+        characters_writer::write(dst, char_type{ ':' });
+        number_writer<2>::write(dst, dt.second);
+        if (m_precision != 0)
+        {
+            characters_writer::write(dst, char_type{ '.' });
+            auto fraction = dt.nanosecond;
+            for (unsigned i = m_precision; i < max_precision; ++i)
+                fraction /= 10;
+            for (unsigned i = m_precision; i != 0; --i)
+            {
+                dst[i - 1] = static_cast<char_type>(char_type{ '0' } + fraction % 10);
+                fraction /= 10;
+            }
+            dst += m_precision;
+        }
+        characters_writer::write(dst, char_type{ 'Z' });
+    }
+
+private:
+    unsigned m_precision;
+};
+
+using rfc3339_canonicalizer = basic_rfc3339_canonicalizer<char>;
+
+} // namespace date
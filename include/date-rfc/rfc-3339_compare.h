@@ -0,0 +1,145 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include "details/calendar_helper.h"
+#include "rfc-3339_type.h"
+#include "rfc-3339_converter.h"
+#include "rfc-3339_view.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                             rfc3339 comparison
+// ----------------------------------------------------------------------------
+namespace rfc3339_compare_impl
+{
+
+template <class Char>
+inline int compare_chars(const Char* a, const Char* b, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (a[i] != b[i])
+            return (a[i] < b[i]) ? -1 : 1;
+    }
+    return 0;
+}
+
+inline int compare_chars(const char* a, const char* b, std::size_t size)
+{
+    const int result = std::memcmp(a, b, size);
+    return (result < 0) ? -1 : (result > 0 ? 1 : 0);
+}
+
+//! Seconds since 0001-01-01 in UTC.
+template <class Char>
+inline std::int64_t utc_seconds(const basic_rfc3339_view<Char>& view)
+{
+    using date_time = calendar_helper::date_time;
+    const auto local = calendar_helper::to_seconds_count(date_time{ view.year(), view.month(), view.day(), view.hour(), view.minute(), view.second() });
+    return static_cast<std::int64_t>(local) - static_cast<std::int64_t>(view.offset_in_minutes()) * 60;
+}
+
+template <class Char>
+inline bool read(const Char* data, std::size_t size, std::time_t& seconds, rfc3339::nanosec_type& nanosecond)
+{
+    const Char* pos = data;
+    rfc3339::parts dt;
+    if (!rfc3339::read(pos, data + size, dt) || pos != data + size)
+        return false;
+    nanosecond = dt.nanosecond;
+    return date_converter<rfc3339, std::time_t>::from_parts(dt, seconds);
+}
+
+template <class Number>
+inline int compare_numbers(Number a, Number b)
+{
+    return (a < b) ? -1 : (a > b ? 1 : 0);
+}
+
+} // namespace rfc3339_compare_impl
+
+// ----------------------------------------------------------------------------
+//! Compares instants of two RFC 3339 timestamps; result is -1, 0 or 1.
+//  Timestamps of one length with the same offset suffix (e.g. both 'Z') are
+//  compared as text. Other timestamps of the canonical layout are compared
+//  by decoded fields adjusted by their offsets, and only the rest is read by
+//  rfc3339::read. Fields are checked as rfc3339::read checks them whichever
+//  way is taken. Returns false when a string is not a timestamp.
+template <class Char>
+bool compare_rfc3339(const Char* a, std::size_t a_size, const Char* b, std::size_t b_size, int& result)
+{
+    namespace impl = rfc3339_compare_impl;
+
+    const basic_rfc3339_view<Char> a_view(a, a_size);
+    const basic_rfc3339_view<Char> b_view(b, b_size);
+    if (a_view.valid() && b_view.valid() && a_view.size() == a_size && b_view.size() == b_size)
+    {
+        if (!a_view.validate() || !b_view.validate())
+            return false;
+
+        //! Equal lengths and equal offsets mean equal fraction lengths.
+        const bool is_same_offset = (a_size == b_size) && (
+            (a[a_size - 1] == Char{ 'Z' } && b[b_size - 1] == Char{ 'Z' }) ||
+            (a[a_size - 1] != Char{ 'Z' } && impl::compare_chars(a + a_size - 6, b + b_size - 6, 6) == 0));
+        if (is_same_offset)
+        {
+            result = impl::compare_chars(a, b, a_size);
+            return true;
+        }
+
+        result = impl::compare_numbers(impl::utc_seconds(a_view), impl::utc_seconds(b_view));
+        if (result == 0)
+            result = impl::compare_numbers(a_view.nanosecond(), b_view.nanosecond());
+        return true;
+    }
+
+    std::time_t a_seconds = 0;
+    std::time_t b_seconds = 0;
+    rfc3339::nanosec_type a_nanosecond = 0;
+    rfc3339::nanosec_type b_nanosecond = 0;
+    if (!impl::read(a, a_size, a_seconds, a_nanosecond) || !impl::read(b, b_size, b_seconds, b_nanosecond))
+        return false;
+
+    result = impl::compare_numbers(a_seconds, b_seconds);
+    if (result == 0)
+        result = impl::compare_numbers(a_nanosecond, b_nanosecond);
+    return true;
+}
+
+template <class Char>
+bool compare_rfc3339(const std::basic_string<Char>& a, const std::basic_string<Char>& b, int& result)
+{
+    return compare_rfc3339(a.data(), a.size(), b.data(), b.size(), result);
+}
+
+} // namespace date
@@ -36,7 +36,7 @@ namespace date
 template <>
 struct date_converter<rfc3339, std::time_t, void>
 {
-    static bool from_parts(const rfc3339::parts& parts, std::time_t& timepoint)
+    static DATE_RFC_CONSTEXPR14 bool from_parts(const rfc3339::parts& parts, std::time_t& timepoint)
     {
         using date_time = calendar_helper::date_time;
         const auto epoch_offset = calendar_helper::to_seconds_count(date_time{ 1970, 1, 1, 0, 0, 0 });
@@ -45,7 +45,7 @@ struct date_converter<rfc3339, std::time_t, void>
         return true;
     }
 
-    static bool to_parts(std::time_t timepoint, rfc3339::parts& parts)
+    static DATE_RFC_CONSTEXPR14 bool to_parts(std::time_t timepoint, rfc3339::parts& parts)
     {
         using date_time = calendar_helper::date_time;
         const auto epoch_offset = calendar_helper::to_seconds_count(date_time{ 1970, 1, 1, 0, 0, 0 });
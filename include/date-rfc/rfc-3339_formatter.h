@@ -32,10 +32,10 @@ namespace date
 {
 
 // ----------------------------------------------------------------------------
-template <class Date, class Converter = date_converter<rfc3339, Date>>
-format_rfc<rfc3339, Date> format_rfc3339(Date& value, const rfc3339& format = rfc3339())
+template <class Date, class Converter = date_converter<rfc3339, Date>, class Policy = strict_validation>
+format_rfc<rfc3339, Date, Converter, Policy> format_rfc3339(Date& value, const rfc3339& format = rfc3339())
 {
-    return format_rfc<rfc3339, Date, Converter>(value, format);
+    return format_rfc<rfc3339, Date, Converter, Policy>(value, format);
 }
 
 } // namespace date
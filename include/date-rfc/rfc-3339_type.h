@@ -33,6 +33,7 @@
 #include "details/calendar_helper.h"
 #include "details/data_writers.h"
 #include "details/fmt_common.h"
+#include "details/validation_policy.h"
 
 // ----------------------------------------------------------------------------
 namespace date
@@ -64,30 +65,48 @@ struct rfc3339
         offset_type  offset_in_minutes = 0; //!< [-1439 .. 1439]
     };
 
-    static bool validate(const parts& dt)
+    template <class Policy = strict_validation>
+    static DATE_RFC_CONSTEXPR14 bool validate(const parts& dt)
     {
-        if (dt.year == 0)
-            return false;
-        if (dt.month == 0 || dt.month > 12)
-            return false;
-        if (dt.day == 0 || dt.day > calendar_helper::days_in_month(dt.year, dt.month))
-            return false;
-        if (dt.hour > 23)
-            return false;
-        if (dt.minute > 59)
-            return false;
-        if (dt.second > 59)
-            return false;
-        if (dt.nanosecond > 999999999)
-            return false;
-        if (std::abs(dt.offset_in_minutes) > 1439)
-            return false;
+        if (Policy::check_ranges)
+        {
+            if (dt.year == 0)
+                return false;
+            if (dt.month == 0 || dt.month > 12)
+                return false;
+            if (dt.day == 0 || dt.day > 31)
+                return false;
+            if (dt.hour > 23)
+                return false;
+            if (dt.minute > 59)
+                return false;
+            if (dt.second > 59)
+                return false;
+            if (dt.nanosecond > 999999999)
+                return false;
+            if (dt.offset_in_minutes < -1439 || dt.offset_in_minutes > 1439)
+                return false;
+        }
+        if (Policy::check_calendar)
+        {
+            if (dt.day > calendar_helper::days_in_month(dt.year, dt.month))
+                return false;
+        }
         return true;
     }
 
-    template <class Iterator>
+    template <class Policy = strict_validation, class Iterator>
     static bool read(Iterator& pos, const Iterator& end, parts& value)
     {
+        return read_profile<9, Policy>(pos, end, value);
+    }
+
+    //! Reads the format with at most FractionDigits digits of the second
+    //  fraction, as required by profiles of RFC 3339 (e.g. RFC 5424).
+    template <unsigned FractionDigits, class Policy = strict_validation, class Iterator>
+    static bool read_profile(Iterator& pos, const Iterator& end, parts& value)
+    {
+        static_assert(FractionDigits >= 1 && FractionDigits <= 9, "Fraction must have 1 to 9 digits");
         using char_type = typename iterator_traits<Iterator>::value_type;
 
         pos = skip_spaces(pos, end);
@@ -97,8 +116,10 @@ struct rfc3339
         parts dt{};
         std::memset(static_cast<void*>(&dt), 0, sizeof(parts));
 
-        offset_type offset_hours = 0;
-        offset_type offset_minutes = 0;
+        offset_type east_hours = 0;
+        offset_type east_minutes = 0;
+        offset_type west_hours = 0;
+        offset_type west_minutes = 0;
         auto fmt = format(
             unsigned_integer<4, 4>(dt.year),   character<char_type>('-'),
             unsigned_integer<2, 2>(dt.month),  character<char_type>('-'),
@@ -108,27 +129,96 @@ struct rfc3339
             unsigned_integer<2, 2>(dt.second),
             optional(
                 character<char_type>('.'),
-                fraction<9>(dt.nanosecond)),
+                fraction<FractionDigits>(dt.nanosecond)),
             cases(
                 branch(
                     character<char_type>('Z')),
                 branch(
-                    signed_integer<2, 2, SignRequired>(offset_hours),
+                    character<char_type>('+'),
+                    unsigned_integer<2, 2>(east_hours),
+                    character<char_type>(':'),
+                    unsigned_integer<2, 2>(east_minutes)),
+                branch(
+                    character<char_type>('-'),
+                    unsigned_integer<2, 2>(west_hours),
                     character<char_type>(':'),
-                    unsigned_integer<2, 2>(offset_minutes))));
+                    unsigned_integer<2, 2>(west_minutes))));
+
+        if (!::date::read(pos, end, fmt))
+            return false;
 
-        if (!::date::read(pos, end, fmt) || !validate(dt))
+        for (unsigned i = FractionDigits; i < 9; ++i)
+            dt.nanosecond *= 10;
+
+        //! The sign is kept by branches, so '-00:30' is west of UTC as well.
+        if (Policy::check_ranges && (east_hours > 23 || east_minutes > 59 || west_hours > 23 || west_minutes > 59))
+            return false;
+        dt.offset_in_minutes = static_cast<offset_type>((east_hours * 60 + east_minutes) - (west_hours * 60 + west_minutes));
+
+        if (!validate<Policy>(dt))
             return false;
 
         value = dt;
-        value.offset_in_minutes = offset_hours * 60 + (offset_hours > 0 ? offset_minutes : -offset_minutes);
         return true;
     }
 
-    template <class Iterator>
+    template <class Policy = strict_validation, class Iterator>
+    static bool validate_only(Iterator& pos, const Iterator& end)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        pos = skip_spaces(pos, end);
+        if (pos == end)
+            return false;
+
+        //! Optional parts are chosen by one look-ahead character, so nothing
+        //  is cached and the offset is checked but never converted.
+        parts dt{};
+        auto date_time = format(
+            unsigned_integer<4, 4>(dt.year),   character<char_type>('-'),
+            unsigned_integer<2, 2>(dt.month),  character<char_type>('-'),
+            unsigned_integer<2, 2>(dt.day),    character<char_type>('T'),
+            unsigned_integer<2, 2>(dt.hour),   character<char_type>(':'),
+            unsigned_integer<2, 2>(dt.minute), character<char_type>(':'),
+            unsigned_integer<2, 2>(dt.second));
+        if (!::date::read(pos, end, date_time))
+            return false;
+
+        if (pos != end && *pos == char_type{ '.' })
+        {
+            auto secfrac = format(character<char_type>('.'), fraction<9>(dt.nanosecond));
+            if (!::date::read(pos, end, secfrac))
+                return false;
+        }
+
+        if (pos == end)
+            return false;
+
+        if (*pos == char_type{ 'Z' })
+        {
+            ++pos;
+        }
+        else
+        {
+            offset_type offset_hours = 0;
+            offset_type offset_minutes = 0;
+            auto numoffset = format(
+                signed_integer<2, 2, SignRequired>(offset_hours),
+                character<char_type>(':'),
+                unsigned_integer<2, 2>(offset_minutes));
+            if (!::date::read(pos, end, numoffset))
+                return false;
+            if (Policy::check_ranges && (std::abs(offset_hours) > 23 || offset_minutes > 59))
+                return false;
+        }
+
+        return validate<Policy>(dt);
+    }
+
+    template <class Policy = strict_validation, class Iterator>
     static bool write(const parts& dt, Iterator& dst)
     {
-        if (!validate(dt))
+        if (!validate<Policy>(dt))
             return false;
 
         using char_type = typename iterator_traits<Iterator>::value_type;
@@ -0,0 +1,237 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include "rfc-3339_type.h"
+#include "rfc-3339_converter.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                                rfc3339 view
+// ----------------------------------------------------------------------------
+//! Non-owning view of an RFC 3339 timestamp inside a character buffer.
+//  Construction only checks the layout (digit and separator positions) and
+//  records where the fraction and the offset are; fields are decoded on
+//  every access and are not range checked (use validate() for that).
+//  Accessors of an invalid view return zeros. The buffer must outlive the
+//  view.
+template <class Char>
+class basic_rfc3339_view
+{
+public:
+    using char_type         = Char;
+    using year_type         = rfc3339::year_type;
+    using month_type        = rfc3339::month_type;
+    using day_type          = rfc3339::day_type;
+    using hour_type         = rfc3339::hour_type;
+    using minute_type       = rfc3339::minute_type;
+    using second_type       = rfc3339::second_type;
+    using nanosec_type      = rfc3339::nanosec_type;
+    using offset_type       = rfc3339::offset_type;
+
+    enum : std::size_t { date_length = 10 };    //!< 'YYYY-MM-DD'
+    enum : std::size_t { min_length  = 20 };    //!< 'YYYY-MM-DDTHH:MM:SSZ'
+    enum : std::size_t { max_length  = 35 };    //!< 'YYYY-MM-DDTHH:MM:SS.nnnnnnnnn+HH:MM'
+
+public:
+    basic_rfc3339_view() = default;
+
+    basic_rfc3339_view(const char_type* data, std::size_t size)
+        : m_data(data)
+    {
+        m_size = scan(data, size, m_fraction_length);
+    }
+
+    bool valid() const
+    {
+        return (m_size != 0);
+    }
+
+    explicit operator bool() const
+    {
+        return valid();
+    }
+
+    //! Start of the timestamp and number of characters it occupies.
+    const char_type* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+
+    year_type    year()   const { return static_cast<year_type>(decode(0, 4)); }
+    month_type   month()  const { return static_cast<month_type>(decode(5, 2)); }
+    day_type     day()    const { return static_cast<day_type>(decode(8, 2)); }
+    hour_type    hour()   const { return static_cast<hour_type>(decode(11, 2)); }
+    minute_type  minute() const { return static_cast<minute_type>(decode(14, 2)); }
+    second_type  second() const { return static_cast<second_type>(decode(17, 2)); }
+
+    nanosec_type nanosecond() const
+    {
+        auto value = static_cast<nanosec_type>(decode(20, m_fraction_length));
+        for (std::size_t i = m_fraction_length; i < 9; ++i)
+            value *= 10;
+        return value;
+    }
+
+    offset_type offset_in_minutes() const
+    {
+        if (!valid())
+            return 0;
+
+        const std::size_t offset_pos = offset_position();
+        if (m_data[offset_pos] == char_type{ 'Z' })
+            return 0;
+
+        const auto hours = static_cast<offset_type>(decode(offset_pos + 1, 2));
+        const auto minutes = static_cast<offset_type>(decode(offset_pos + 4, 2));
+        const auto offset = static_cast<offset_type>(hours * 60 + minutes);
+        return (m_data[offset_pos] == char_type{ '-' }) ? static_cast<offset_type>(-offset) : offset;
+    }
+
+    rfc3339::parts to_parts() const
+    {
+        rfc3339::parts dt{};
+        if (!valid())
+            return dt;
+
+        dt.year   = year();
+        dt.month  = month();
+        dt.day    = day();
+        dt.hour   = hour();
+        dt.minute = minute();
+        dt.second = second();
+        dt.nanosecond = nanosecond();
+        dt.offset_in_minutes = offset_in_minutes();
+        return dt;
+    }
+
+    //! Checks what rfc3339::read checks, offset hours and minutes included.
+    template <class Policy = strict_validation>
+    bool validate() const
+    {
+        return valid() && validate_offset<Policy>() && rfc3339::validate<Policy>(to_parts());
+    }
+
+    //! Converts a valid timestamp (see validate()).
+    template <class Policy = strict_validation>
+    bool to_time_t(std::time_t& timepoint) const
+    {
+        return validate<Policy>() && date_converter<rfc3339, std::time_t>::from_parts(to_parts(), timepoint);
+    }
+
+private:
+    static bool is_digit(char_type ch)
+    {
+        return (ch >= char_type{ '0' }) && (ch <= char_type{ '9' });
+    }
+
+    static bool is_digits(const char_type* data, std::size_t pos, std::size_t count)
+    {
+        for (std::size_t i = pos; i < pos + count; ++i)
+        {
+            if (!is_digit(data[i]))
+                return false;
+        }
+        return true;
+    }
+
+    //! Returns the timestamp length or 0 when the layout does not match.
+    static std::size_t scan(const char_type* data, std::size_t size, std::uint8_t& fraction_length)
+    {
+        fraction_length = 0;
+        if (size < min_length)
+            return 0;
+
+        if (!is_digits(data, 0, 4)  || data[4]  != char_type{ '-' } ||
+            !is_digits(data, 5, 2)  || data[7]  != char_type{ '-' } ||
+            !is_digits(data, 8, 2)  || data[10] != char_type{ 'T' } ||
+            !is_digits(data, 11, 2) || data[13] != char_type{ ':' } ||
+            !is_digits(data, 14, 2) || data[16] != char_type{ ':' } ||
+            !is_digits(data, 17, 2))
+            return 0;
+
+        std::size_t pos = 19;
+        if (data[pos] == char_type{ '.' })
+        {
+            ++pos;
+            while (pos < size && fraction_length < 9 && is_digit(data[pos]))
+            {
+                ++pos;
+                ++fraction_length;
+            }
+            if (fraction_length == 0 || pos == size)
+                return 0;
+        }
+
+        if (data[pos] == char_type{ 'Z' })
+            return pos + 1;
+
+        if (data[pos] != char_type{ '+' } && data[pos] != char_type{ '-' })
+            return 0;
+
+        if (size - pos < 6 || !is_digits(data, pos + 1, 2) || data[pos + 3] != char_type{ ':' } || !is_digits(data, pos + 4, 2))
+            return 0;
+
+        return pos + 6;
+    }
+
+    std::size_t offset_position() const
+    {
+        return (m_fraction_length == 0) ? 19 : 20 + m_fraction_length;
+    }
+
+    template <class Policy>
+    bool validate_offset() const
+    {
+        const std::size_t offset_pos = offset_position();
+        if (!Policy::check_ranges || m_data[offset_pos] == char_type{ 'Z' })
+            return true;
+        return decode(offset_pos + 1, 2) <= 23 && decode(offset_pos + 4, 2) <= 59;
+    }
+
+    std::uint32_t decode(std::size_t pos, std::size_t count) const
+    {
+        std::uint32_t value = 0;
+        if (!valid())
+            return value;
+
+        for (std::size_t i = pos; i < pos + count; ++i)
+            value = 10 * value + static_cast<std::uint32_t>(m_data[i] - char_type{ '0' });
+        return value;
+    }
+
+private:
+    const char_type* m_data = nullptr;
+    std::size_t m_size = 0;
+    std::uint8_t m_fraction_length = 0;
+};
+
+// ----------------------------------------------------------------------------
+using rfc3339_view = basic_rfc3339_view<char>;
+
+} // namespace date
@@ -0,0 +1,340 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cctype>
+#include <ctime>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include "details/static_string.h"
+#include "details/iterator_traits.h"
+#include "details/calendar_helper.h"
+#include "details/data_writers.h"
+#include "details/fmt_common.h"
+#include "details/validation_policy.h"
+#include "rfc-1123_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                                  rfc5322
+// ----------------------------------------------------------------------------
+//! Internet Message Format date-time (RFC 5322, sections 3.3 and 4.3)
+//  including the obsolete syntax: comments and folding white space between
+//  tokens, case-insensitive names, 2- and 3-digit years and obsolete zones.
+//  The raw header value is read in place in one pass.
+struct rfc5322
+{
+    using year_type     = rfc1123::year_type;
+    using month_type    = rfc1123::month_type;
+    using day_type      = rfc1123::day_type;
+    using week_day_type = rfc1123::week_day_type;
+    using hour_type     = rfc1123::hour_type;
+    using minute_type   = rfc1123::minute_type;
+    using second_type   = rfc1123::second_type;
+    using offset_type   = rfc1123::offset_type;
+    using parts         = rfc1123::parts;
+
+    template <class Policy = strict_validation>
+    static bool validate(const parts& dt)
+    {
+        return rfc1123::validate<Policy>(dt);
+    }
+
+    template <class Char>
+    static constexpr std::array<std::pair<static_string<Char, 4>, int16_t>, 35> zone_names()
+    {
+        //! Military zones are treated as '-0000' (section 4.3): their offsets
+        //  were specified incorrectly in RFC 822.
+        using string = static_string<Char, 4>;
+        return {
+            std::make_pair(string("Z"),   int16_t(0)),
+            std::make_pair(string("GMT"), int16_t(0)),
+            std::make_pair(string("UT"),  int16_t(0)),
+            std::make_pair(string("EST"), int16_t(-5 * 60)),
+            std::make_pair(string("EDT"), int16_t(-4 * 60)),
+            std::make_pair(string("CST"), int16_t(-6 * 60)),
+            std::make_pair(string("CDT"), int16_t(-5 * 60)),
+            std::make_pair(string("MST"), int16_t(-7 * 60)),
+            std::make_pair(string("MDT"), int16_t(-6 * 60)),
+            std::make_pair(string("PST"), int16_t(-8 * 60)),
+            std::make_pair(string("PDT"), int16_t(-7 * 60)),
+            std::make_pair(string("A"),   int16_t(0)),
+            std::make_pair(string("B"),   int16_t(0)),
+            std::make_pair(string("C"),   int16_t(0)),
+            std::make_pair(string("D"),   int16_t(0)),
+            std::make_pair(string("E"),   int16_t(0)),
+            std::make_pair(string("F"),   int16_t(0)),
+            std::make_pair(string("G"),   int16_t(0)),
+            std::make_pair(string("H"),   int16_t(0)),
+            std::make_pair(string("I"),   int16_t(0)),
+            std::make_pair(string("K"),   int16_t(0)),
+            std::make_pair(string("L"),   int16_t(0)),
+            std::make_pair(string("M"),   int16_t(0)),
+            std::make_pair(string("N"),   int16_t(0)),
+            std::make_pair(string("O"),   int16_t(0)),
+            std::make_pair(string("P"),   int16_t(0)),
+            std::make_pair(string("Q"),   int16_t(0)),
+            std::make_pair(string("R"),   int16_t(0)),
+            std::make_pair(string("S"),   int16_t(0)),
+            std::make_pair(string("T"),   int16_t(0)),
+            std::make_pair(string("U"),   int16_t(0)),
+            std::make_pair(string("V"),   int16_t(0)),
+            std::make_pair(string("W"),   int16_t(0)),
+            std::make_pair(string("X"),   int16_t(0)),
+            std::make_pair(string("Y"),   int16_t(0)),
+        };
+    }
+
+    //! obs-year: 2-digit years below 50 are 20xx, other 2- and 3-digit years
+    //  are counted from 1900.
+    static year_type expand_year(year_type year, std::size_t digits)
+    {
+        if (digits == 2 && year < 50)
+            return static_cast<year_type>(year + 2000);
+        if (digits <= 3)
+            return static_cast<year_type>(year + 1900);
+        return year;
+    }
+
+    //! Skips CFWS: white space, line breaks of folding and nested comments
+    //  with quoted pairs. Returns false on an unterminated comment.
+    template <class Iterator>
+    static bool skip_cfws(Iterator& pos, const Iterator& end)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        std::size_t depth = 0;
+        bool is_quoted = false;
+        for (; pos != end; ++pos)
+        {
+            const char_type ch = *pos;
+            if (depth != 0)
+            {
+                if (is_quoted)
+                    is_quoted = false;
+                else if (ch == char_type{ '\\' })
+                    is_quoted = true;
+                else if (ch == char_type{ '(' })
+                    ++depth;
+                else if (ch == char_type{ ')' })
+                    --depth;
+                continue;
+            }
+
+            if (ch == char_type{ '(' })
+                ++depth;
+            else if (ch != char_type{ ' ' } && ch != char_type{ '\t' } && ch != char_type{ '\r' } && ch != char_type{ '\n' })
+                return true;
+        }
+        return (depth == 0);
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool read(Iterator& pos, const Iterator& end, parts& value)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        constexpr auto weekday_aliases = rfc1123::weekday_names<char_type>();
+        constexpr auto month_aliases = rfc1123::month_names<char_type>();
+
+        parts dt{};
+        std::memset(static_cast<void*>(&dt), 0, sizeof(parts));
+
+        if (!skip_cfws(pos, end) || pos == end)
+            return false;
+
+        if (!is_digit(*pos))
+        {
+            auto day_name = format(aliases_icase(dt.week_day, weekday_aliases));
+            if (!::date::read(pos, end, day_name) || !skip_cfws(pos, end) || pos == end || *pos != char_type{ ',' })
+                return false;
+            ++pos;
+        }
+
+        std::size_t digits = 0;
+        if (!skip_cfws(pos, end) || !read_number(pos, end, 1, 2, dt.day, digits))
+            return false;
+
+        auto month = format(aliases_icase(dt.month, month_aliases));
+        if (!skip_cfws(pos, end) || !::date::read(pos, end, month))
+            return false;
+
+        if (!skip_cfws(pos, end) || !read_number(pos, end, 2, 4, dt.year, digits))
+            return false;
+        dt.year = expand_year(dt.year, digits);
+
+        if (!skip_cfws(pos, end) || !read_number(pos, end, 2, 2, dt.hour, digits) ||
+            !skip_cfws(pos, end) || !read_character(pos, end, char_type{ ':' }) ||
+            !skip_cfws(pos, end) || !read_number(pos, end, 2, 2, dt.minute, digits) ||
+            !skip_cfws(pos, end) || pos == end)
+            return false;
+
+        if (*pos == char_type{ ':' })
+        {
+            ++pos;
+            if (!skip_cfws(pos, end) || !read_number(pos, end, 2, 2, dt.second, digits) || !skip_cfws(pos, end) || pos == end)
+                return false;
+        }
+
+        const char_type sign = *pos;
+        if (sign == char_type{ '+' } || sign == char_type{ '-' })
+        {
+            ++pos;
+            offset_type offset = 0;
+            if (!read_number(pos, end, 4, 4, offset, digits) || (offset % 100) > 59)
+                return false;
+            offset = static_cast<offset_type>((offset / 100) * 60 + offset % 100);
+            dt.offset_in_minutes = (sign == char_type{ '-' }) ? static_cast<offset_type>(-offset) : offset;
+        }
+        else if (!read_zone(pos, end, dt.offset_in_minutes))
+        {
+            return false;
+        }
+
+        if (!skip_cfws(pos, end) || !validate<Policy>(dt))
+            return false;
+
+        if (dt.week_day == 0)
+            dt.week_day = calendar_helper::day_of_week(calendar_helper::date{ dt.year, dt.month, dt.day });
+
+        value = dt;
+        return true;
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool write(const parts& dt, Iterator& dst)
+    {
+        if (!validate<Policy>(dt))
+            return false;
+
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        constexpr auto weekday_aliases = rfc1123::weekday_names<char_type>();
+        constexpr auto month_aliases = rfc1123::month_names<char_type>();
+
+        const week_day_type week_day = (dt.week_day != 0) ? dt.week_day : static_cast<week_day_type>(calendar_helper::day_of_week(calendar_helper::date{ dt.year, dt.month, dt.day }));
+        const auto offset = std::abs(dt.offset_in_minutes);
+
+        characters_writer::write(dst, weekday_aliases[week_day - 1].first);
+        characters_writer::write(dst, char_type{ ',' });
+        characters_writer::write(dst, char_type{ ' ' });
+        number_writer<2>::write(dst, dt.day);
+        characters_writer::write(dst, char_type{ ' ' });
+        characters_writer::write(dst, month_aliases[dt.month - 1].first);
+        characters_writer::write(dst, char_type{ ' ' });
+        number_writer<4>::write(dst, dt.year);
+        characters_writer::write(dst, char_type{ ' ' });
+        number_writer<2>::write(dst, dt.hour);
+        characters_writer::write(dst, char_type{ ':' });
+        number_writer<2>::write(dst, dt.minute);
+        characters_writer::write(dst, char_type{ ':' });
+        number_writer<2>::write(dst, dt.second);
+        characters_writer::write(dst, char_type{ ' ' });
+        characters_writer::write(dst, char_type{ (dt.offset_in_minutes < 0) ? '-' : '+' });
+        number_writer<2>::write(dst, offset / 60);
+        number_writer<2>::write(dst, offset % 60);
+
+        return true;
+    }
+
+private:
+    template <class Char>
+    static bool is_digit(Char ch)
+    {
+        return (ch >= Char{ '0' }) && (ch <= Char{ '9' });
+    }
+
+    template <class Iterator, class Char>
+    static bool read_character(Iterator& pos, const Iterator& end, Char ch)
+    {
+        if (pos == end || *pos != ch)
+            return false;
+        ++pos;
+        return true;
+    }
+
+    template <class Char>
+    static bool is_letter(Char ch)
+    {
+        return (ch >= Char{ 'A' } && ch <= Char{ 'Z' }) || (ch >= Char{ 'a' } && ch <= Char{ 'z' });
+    }
+
+    //! Reads obs-zone as a whole word, so 'UT' is not taken for 'U' and
+    //  'Proxy' is not taken for 'P'.
+    template <class Iterator>
+    static bool read_zone(Iterator& pos, const Iterator& end, offset_type& value)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+        constexpr auto zone_aliases = zone_names<char_type>();
+
+        char_type name[4] = {};
+        std::size_t length = 0;
+        for (; pos != end && is_letter(*pos); ++pos)
+        {
+            if (length == 4)
+                return false;
+            name[length++] = *pos;
+        }
+
+        for (const auto& zone : zone_aliases)
+        {
+            const char_type* str = zone.first.c_str();
+            std::size_t i = 0;
+            while (i < length && alias_character_equal<true>(name[i], str[i]))
+                ++i;
+            if (length != 0 && i == length && str[i] == char_type{ '\0' })
+            {
+                value = zone.second;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <class Iterator, class Value>
+    static bool read_number(Iterator& pos, const Iterator& end, std::size_t min, std::size_t max, Value& value, std::size_t& digits)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        unsigned x = 0;
+        digits = 0;
+        for (; pos != end && digits < max; ++pos, ++digits)
+        {
+            const char_type ch = *pos;
+            if (!is_digit(ch))
+                break;
+            x = 10 * x + static_cast<unsigned>(ch - char_type{ '0' });
+        }
+
+        if (digits < min)
+            return false;
+
+        value = static_cast<Value>(x);
+        return true;
+    }
+};
+
+} // namespace date
@@ -0,0 +1,108 @@
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Yury Prostov
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+
+#include <cstring>
+#include <iterator>
+#include "details/iterator_traits.h"
+#include "details/data_writers.h"
+#include "details/fmt_common.h"
+#include "details/validation_policy.h"
+#include "rfc-3339_type.h"
+
+// ----------------------------------------------------------------------------
+namespace date
+{
+
+// ----------------------------------------------------------------------------
+//                                  rfc5424
+// ----------------------------------------------------------------------------
+//! Syslog TIMESTAMP of RFC 5424 (section 6.2.3): the RFC 3339 profile with at
+//  most 6 digits of the second fraction, or NILVALUE ('-') when the time is
+//  not known.
+struct rfc5424
+{
+    using year_type    = rfc3339::year_type;
+    using month_type   = rfc3339::month_type;
+    using day_type     = rfc3339::day_type;
+    using hour_type    = rfc3339::hour_type;
+    using minute_type  = rfc3339::minute_type;
+    using second_type  = rfc3339::second_type;
+    using nanosec_type = rfc3339::nanosec_type;
+    using offset_type  = rfc3339::offset_type;
+
+    struct parts : rfc3339::parts
+    {
+        bool nil = false;   //!< NILVALUE, the other fields are not defined.
+    };
+
+    template <class Policy = strict_validation>
+    static bool validate(const parts& dt)
+    {
+        if (dt.nil)
+            return true;
+        if (Policy::check_ranges && (dt.nanosecond % 1000) != 0)
+            return false;
+        return rfc3339::validate<Policy>(dt);
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool read(Iterator& pos, const Iterator& end, parts& value)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        pos = skip_spaces(pos, end);
+        if (pos == end)
+            return false;
+
+        if (*pos == char_type{ '-' })
+        {
+            ++pos;
+            value = parts{};
+            value.nil = true;
+            return true;
+        }
+
+        parts dt{};
+        if (!rfc3339::read_profile<6, Policy>(pos, end, dt))
+            return false;
+
+        value = dt;
+        return true;
+    }
+
+    template <class Policy = strict_validation, class Iterator>
+    static bool write(const parts& dt, Iterator& dst)
+    {
+        using char_type = typename iterator_traits<Iterator>::value_type;
+
+        if (!dt.nil)
+            return rfc3339::write<Policy>(dt, dst);
+
+        characters_writer::write(dst, char_type{ '-' });
+        return true;
+    }
+};
+
+} // namespace date
@@ -0,0 +1,105 @@
+#include <cstdio>
+#include <cstring>
+#include <date-rfc/rfc-1123.h>
+#include <date-rfc/rfc-3339.h>
+#include <date-rfc/date_literals.h>
+
+static_assert(DATE_RFC_HAS_CONSTEXPR14, "Literals are checked as C++14");
+
+using namespace date::literals;
+
+// ----------------------------------------------------------------------------
+//! Literals are evaluated at compile time.
+static_assert("1985-04-12T23:20:50.52Z"_rfc3339 == 482196050, "RFC 3339 literal");
+static_assert("1996-12-19T16:39:57-08:00"_rfc3339 == 851042397, "RFC 3339 literal with a negative offset");
+static_assert("2000-01-01T00:00:00+00:30"_rfc3339 == 946683000, "RFC 3339 literal with '+00:MM'");
+static_assert("2000-01-01T00:00:00-00:30"_rfc3339 == 946686600, "RFC 3339 literal with '-00:MM'");
+static_assert("Sun, 06 Nov 1994 08:49:37 GMT"_rfc1123 == 784111777, "RFC 1123 literal");
+static_assert("06 Nov 94 03:49:37 EST"_rfc1123 == 784111777, "RFC 1123 literal with a zone name");
+static_assert("01 Jan 2000 00:00 +0030"_rfc1123 == 946683000, "RFC 1123 literal with '+00MM'");
+static_assert("01 Jan 2000 00:00 -0030"_rfc1123 == 946686600, "RFC 1123 literal with '-00MM'");
+
+// ----------------------------------------------------------------------------
+//! Literal readers must accept exactly what the runtime readers accept (as a
+//  whole string) and give the same parts.
+static const char* const rfc3339_inputs[] = {
+    "1985-04-12T23:20:50.52Z",
+    "1996-12-19T16:39:57-08:00",
+    "2000-01-01T00:00:00+00:30",
+    "2000-01-01T00:00:00-00:30",
+    "2000-01-01T00:00:00.123456789Z",
+    "2000-01-01T00:00:00.1234567891Z",
+    "2000-01-01T00:00:00+05:75",
+    "2000-01-01T00:00:00+24:00",
+    "2000-02-30T00:00:00Z",
+    "1990-12-31T23:59:60Z",
+    "2000-01-01T00:00:00",
+    "2000-01-01T00:00:00.Z",
+    "2000-01-01 00:00:00Z",
+    "2000-01-01T00:00:00z",
+    "2000-01-01T00:00:00+0530",
+};
+
+static const char* const rfc1123_inputs[] = {
+    "Sun, 06 Nov 1994 08:49:37 GMT",
+    "06 Nov 94 08:49 EST",
+    "6 Nov 1994 08:49:37 UT",
+    "01 Jan 2000 00:00 +0030",
+    "01 Jan 2000 00:00 -0030",
+    "01 Jan 2000 00:00 Z",
+    "Mon, 06 Nov 1994 08:49:37 GMT",
+    "Sun, 31 Nov 1994 08:49:37 GMT",
+    "Sun, 06 Nov 1994 08:49:37 Proxy",
+    "Sun, 06 Nov 1994 08:49:37 G",
+    "Sun, 06 Nov 1994 08:49:37 UTC",
+    "Sun, 06 Nov 1994 24:49:37 GMT",
+    "Sun 06 Nov 1994 08:49:37 GMT",
+};
+
+bool same_parts(const date::rfc3339::parts& a, const date::rfc3339::parts& b)
+{
+    return a.year == b.year && a.month == b.month && a.day == b.day && a.hour == b.hour && a.minute == b.minute &&
+        a.second == b.second && a.nanosecond == b.nanosecond && a.offset_in_minutes == b.offset_in_minutes;
+}
+
+bool same_parts(const date::rfc1123::parts& a, const date::rfc1123::parts& b)
+{
+    return a.year == b.year && a.month == b.month && a.day == b.day && a.hour == b.hour && a.minute == b.minute &&
+        a.second == b.second && a.offset_in_minutes == b.offset_in_minutes;
+}
+
+template <class Format, class LiteralRead>
+int check(const char* const* first, const char* const* last, LiteralRead literal_read)
+{
+    int failures = 0;
+    for (; first != last; ++first)
+    {
+        const char* str = *first;
+        const char* end = str + std::strlen(str);
+
+        typename Format::parts runtime_parts{};
+        const char* pos = str;
+        const bool runtime_ok = Format::read(pos, end, runtime_parts) && pos == end;
+
+        typename Format::parts literal_parts{};
+        const bool literal_ok = literal_read(str, end, literal_parts);
+
+        if (runtime_ok != literal_ok || (runtime_ok && !same_parts(runtime_parts, literal_parts)))
+        {
+            std::printf("FAIL: '%s' is read as %d at run time and as %d by literals\n", str, runtime_ok, literal_ok);
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+// ----------------------------------------------------------------------------
+int main()
+{
+    int failures = 0;
+    failures += check<date::rfc3339>(std::begin(rfc3339_inputs), std::end(rfc3339_inputs),
+        [](const char* pos, const char* end, date::rfc3339::parts& dt) { return date::literal_reader::read_rfc3339(pos, end, dt); });
+    failures += check<date::rfc1123>(std::begin(rfc1123_inputs), std::end(rfc1123_inputs),
+        [](const char* pos, const char* end, date::rfc1123::parts& dt) { return date::literal_reader::read_rfc1123(pos, end, dt); });
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+//! Measures date::date_cache on a repetitive corpus: every thread decodes the
+//  same set of RFC 3339 timestamps in its own order, once through the cache
+//  and once by rfc3339::read, for 1, 2, 4, ... up to the given threads.
+//
+//  Usage: date-cache-bench [options]
+//    --threads N          largest count of threads (default: 64)
+//    --distinct N         distinct timestamps in the corpus (default: 4096)
+//    --reads N            reads per thread (default: 2000000)
+//    --capacity N         entries of the cache (default: 65536)
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+#include <date-rfc/rfc-3339.h>
+#include <date-rfc/date_cache.h>
+
+namespace
+{
+
+// ----------------------------------------------------------------------------
+struct options
+{
+    unsigned threads = 64;
+    std::size_t distinct = 4096;
+    std::size_t reads = 2000000;
+    std::size_t capacity = 64 * 1024;
+};
+
+using cache_type = date::date_cache<date::rfc3339>;
+
+// ----------------------------------------------------------------------------
+bool parse_options(int argc, char* argv[], options& opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = (i + 1 < argc);
+        if (arg == "--threads" && has_value)
+            opts.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--distinct" && has_value)
+            opts.distinct = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--reads" && has_value)
+            opts.reads = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--capacity" && has_value)
+            opts.capacity = std::strtoul(argv[++i], nullptr, 10);
+        else
+            return false;
+    }
+    return opts.threads != 0 && opts.distinct != 0;
+}
+
+// ----------------------------------------------------------------------------
+std::vector<std::string> make_corpus(std::size_t distinct)
+{
+    std::vector<std::string> corpus;
+    for (std::size_t i = 0; i < distinct; ++i) {
+        const std::time_t seconds = 1709294400 + static_cast<std::time_t>(i);
+        date::rfc3339::parts parts;
+        date::date_converter<date::rfc3339, std::time_t>::to_parts(seconds, parts);
+        std::string text;
+        auto output = std::back_inserter(text);
+        date::rfc3339::write(parts, output);
+        corpus.push_back(text);
+    }
+    return corpus;
+}
+
+//! Runs the threads and returns millions of reads per second of all of them.
+template <class Decode>
+double run(unsigned threads, std::size_t reads, const std::vector<std::string>& corpus, Decode decode)
+{
+    std::vector<std::thread> workers;
+    std::vector<uint64_t> sums(threads);
+    const auto started = std::chrono::steady_clock::now();
+    for (unsigned k = 0; k < threads; ++k) {
+        workers.emplace_back([&, k]() {
+            uint64_t sum = 0;
+            std::size_t index = k * 7919;
+            for (std::size_t i = 0; i < reads; ++i) {
+                index = (index + 40503) % corpus.size();
+                std::time_t seconds = 0;
+                uint32_t nanosecond = 0;
+                if (decode(corpus[index], seconds, nanosecond))
+                    sum += static_cast<uint64_t>(seconds);
+            }
+            sums[k] = sum;
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    return seconds > 0 ? static_cast<double>(reads) * threads / seconds / 1e6 : 0.0;
+}
+
+bool parse(const std::string& text, std::time_t& seconds, uint32_t& nanosecond)
+{
+    auto pos = text.begin();
+    date::rfc3339::parts parts;
+    if (!date::rfc3339::read(pos, text.end(), parts))
+        return false;
+    nanosecond = parts.nanosecond;
+    return date::date_converter<date::rfc3339, std::time_t>::from_parts(parts, seconds);
+}
+
+} // namespace
+
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    options opts;
+    if (!parse_options(argc, argv, opts)) {
+        std::fprintf(stderr, "Usage: %s [--threads N] [--distinct N] [--reads N] [--capacity N]\n", argv[0]);
+        return 2;
+    }
+
+    const auto corpus = make_corpus(opts.distinct);
+    std::printf("%8s %14s %14s %8s %12s %12s\n", "threads", "cache Mreads/s", "parse Mreads/s", "speedup", "hits", "misses");
+    for (unsigned threads = 1; threads <= opts.threads; threads = (threads * 2 > opts.threads && threads != opts.threads) ? opts.threads : threads * 2) {
+        cache_type cache(opts.capacity);
+        const double cached = run(threads, opts.reads, corpus, [&cache](const std::string& text, std::time_t& seconds, uint32_t& nanosecond) {
+            return cache.read(text, seconds, nanosecond);
+        });
+        const double parsed = run(threads, opts.reads, corpus, parse);
+        const auto stats = cache.stats();
+        std::printf("%8u %14.1f %14.1f %7.2fx %12llu %12llu\n", threads, cached, parsed, parsed > 0 ? cached / parsed : 0.0,
+            static_cast<unsigned long long>(stats.hits), static_cast<unsigned long long>(stats.misses));
+    }
+    return 0;
+}
@@ -0,0 +1,277 @@
+//! Extracts the timestamp column of a log file: every line is parsed at the
+//  given field and the timestamps are written as a binary column of int64
+//  nanoseconds since the epoch (native byte order, INT64_MIN for lines which
+//  can not be parsed). Rejected lines are written to a text file.
+//
+//  Usage: date-extract [options] <input> <column.bin> <rejects.txt>
+//    --format rfc3339|rfc1123   format of timestamps (default: rfc3339)
+//    --field N                  0-based field where the timestamp starts (default: 0)
+//    --delimiter C              field delimiter (default: space)
+//    --threads N                worker threads (default: hardware concurrency)
+//    --chunk-size BYTES         size of work items (default: 4 MiB)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+#include <date-rfc/rfc-1123.h>
+#include <date-rfc/rfc-3339.h>
+#include "mapped_file.h"
+
+namespace
+{
+
+// ----------------------------------------------------------------------------
+enum class input_format
+{
+    rfc3339,
+    rfc1123,
+};
+
+struct options
+{
+    input_format format = input_format::rfc3339;
+    std::size_t field = 0;
+    char delimiter = ' ';
+    unsigned threads = 0;
+    std::size_t chunk_size = 4 << 20;
+    const char* input = nullptr;
+    const char* column = nullptr;
+    const char* rejects = nullptr;
+};
+
+//! Lines of one chunk: values are in line order, rejects refer to them.
+struct chunk_result
+{
+    std::vector<int64_t> values;
+    std::vector<std::size_t> rejects;
+    std::vector<const char*> reject_lines;
+};
+
+struct thread_stats
+{
+    uint64_t lines = 0;
+    uint64_t bytes = 0;
+    double seconds = 0.0;
+};
+
+const int64_t rejected_value = std::numeric_limits<int64_t>::min();
+
+// ----------------------------------------------------------------------------
+bool parse_options(int argc, char* argv[], options& opts)
+{
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = (i + 1 < argc);
+        if (arg == "--format" && has_value) {
+            const std::string value = argv[++i];
+            if (value == "rfc3339")
+                opts.format = input_format::rfc3339;
+            else if (value == "rfc1123")
+                opts.format = input_format::rfc1123;
+            else
+                return false;
+        }
+        else if (arg == "--field" && has_value) {
+            opts.field = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--delimiter" && has_value) {
+            opts.delimiter = argv[++i][0];
+        }
+        else if (arg == "--threads" && has_value) {
+            opts.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--chunk-size" && has_value) {
+            opts.chunk_size = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg.compare(0, 2, "--") == 0) {
+            return false;
+        }
+        else {
+            files.push_back(argv[i]);
+        }
+    }
+
+    if (files.size() != 3 || opts.chunk_size == 0)
+        return false;
+
+    opts.input = files[0];
+    opts.column = files[1];
+    opts.rejects = files[2];
+    if (opts.threads == 0)
+        opts.threads = std::max(1u, std::thread::hardware_concurrency());
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+//! First line start at or after the offset.
+const char* line_start(const char* data, std::size_t size, std::size_t offset)
+{
+    if (offset == 0)
+        return data;
+    if (offset >= size)
+        return data + size;
+    const void* eol = std::memchr(data + offset - 1, '\n', size - offset + 1);
+    return (eol != nullptr) ? static_cast<const char*>(eol) + 1 : data + size;
+}
+
+// ----------------------------------------------------------------------------
+template <class Format>
+bool to_nanoseconds(const typename Format::parts& parts, uint32_t nanosecond, int64_t& value)
+{
+    std::time_t seconds = 0;
+    if (!date::date_converter<Format, std::time_t>::from_parts(parts, seconds))
+        return false;
+    if (seconds > std::numeric_limits<int64_t>::max() / 1000000000 || seconds < std::numeric_limits<int64_t>::min() / 1000000000 + 1)
+        return false;
+    value = static_cast<int64_t>(seconds) * 1000000000 + nanosecond;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+bool parse_line(const options& opts, const char* pos, const char* end, int64_t& value)
+{
+    for (std::size_t i = 0; i < opts.field; ++i) {
+        const void* delimiter = std::memchr(pos, opts.delimiter, static_cast<std::size_t>(end - pos));
+        if (delimiter == nullptr)
+            return false;
+        pos = static_cast<const char*>(delimiter) + 1;
+    }
+
+    if (opts.format == input_format::rfc3339) {
+        date::rfc3339::parts parts;
+        return date::rfc3339::read(pos, end, parts) && to_nanoseconds<date::rfc3339>(parts, parts.nanosecond, value);
+    }
+
+    date::rfc1123::parts parts;
+    return date::rfc1123::read(pos, end, parts) && to_nanoseconds<date::rfc1123>(parts, 0, value);
+}
+
+// ----------------------------------------------------------------------------
+void process_chunk(const options& opts, const char* pos, const char* end, chunk_result& result)
+{
+    while (pos < end) {
+        const void* eol = std::memchr(pos, '\n', static_cast<std::size_t>(end - pos));
+        const char* line_end = (eol != nullptr) ? static_cast<const char*>(eol) : end;
+
+        int64_t value = rejected_value;
+        if (!parse_line(opts, pos, line_end, value)) {
+            result.rejects.push_back(result.values.size());
+            result.reject_lines.push_back(pos);
+            value = rejected_value;
+        }
+        result.values.push_back(value);
+        pos = line_end + 1;
+    }
+}
+
+// ----------------------------------------------------------------------------
+//! Workers take the next chunk from a shared counter, so a thread which is
+//  done with its chunk takes over the rest of the work of slower threads.
+void run_workers(const options& opts, const mapped_file& file, std::vector<chunk_result>& results, std::vector<thread_stats>& stats)
+{
+    std::atomic<std::size_t> next_chunk(0);
+    std::vector<std::thread> workers;
+    for (unsigned k = 0; k < opts.threads; ++k) {
+        workers.emplace_back([&, k]() {
+            const auto started = std::chrono::steady_clock::now();
+            thread_stats& own = stats[k];
+            for (std::size_t i = next_chunk++; i < results.size(); i = next_chunk++) {
+                const char* first = line_start(file.data(), file.size(), i * opts.chunk_size);
+                const char* last = line_start(file.data(), file.size(), (i + 1) * opts.chunk_size);
+                process_chunk(opts, first, last, results[i]);
+                own.lines += results[i].values.size();
+                own.bytes += static_cast<uint64_t>(last - first);
+            }
+            own.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+}
+
+// ----------------------------------------------------------------------------
+bool write_results(const options& opts, const mapped_file& file, const std::vector<chunk_result>& results, uint64_t& rejects_count)
+{
+    std::FILE* column = std::fopen(opts.column, "wb");
+    std::FILE* rejects = std::fopen(opts.rejects, "wb");
+    bool is_ok = (column != nullptr && rejects != nullptr);
+
+    const char* file_end = file.data() + file.size();
+    uint64_t line_number = 1;
+    rejects_count = 0;
+    for (const auto& result : results) {
+        if (!is_ok)
+            break;
+        if (!result.values.empty())
+            is_ok = (std::fwrite(result.values.data(), sizeof(int64_t), result.values.size(), column) == result.values.size());
+        for (std::size_t i = 0; is_ok && i < result.rejects.size(); ++i) {
+            const char* line = result.reject_lines[i];
+            const void* eol = std::memchr(line, '\n', static_cast<std::size_t>(file_end - line));
+            const std::size_t length = (eol != nullptr) ? static_cast<std::size_t>(static_cast<const char*>(eol) - line) : static_cast<std::size_t>(file_end - line);
+            is_ok = (std::fprintf(rejects, "%llu:", static_cast<unsigned long long>(line_number + result.rejects[i])) > 0)
+                && (std::fwrite(line, 1, length, rejects) == length)
+                && (std::fputc('\n', rejects) != EOF);
+        }
+        line_number += result.values.size();
+        rejects_count += result.rejects.size();
+    }
+
+    if (column != nullptr && std::fclose(column) != 0)
+        is_ok = false;
+    if (rejects != nullptr && std::fclose(rejects) != 0)
+        is_ok = false;
+    return is_ok;
+}
+
+} // namespace
+
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    options opts;
+    if (!parse_options(argc, argv, opts)) {
+        std::fprintf(stderr, "Usage: %s [--format rfc3339|rfc1123] [--field N] [--delimiter C] [--threads N] [--chunk-size BYTES] <input> <column.bin> <rejects.txt>\n", argv[0]);
+        return 2;
+    }
+
+    mapped_file file(opts.input);
+    if (!file.is_open()) {
+        std::fprintf(stderr, "Can not map file '%s'\n", opts.input);
+        return 1;
+    }
+
+    const auto started = std::chrono::steady_clock::now();
+    std::vector<chunk_result> results((file.size() + opts.chunk_size - 1) / opts.chunk_size);
+    std::vector<thread_stats> stats(opts.threads);
+    run_workers(opts, file, results, stats);
+    const double parse_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    uint64_t rejects_count = 0;
+    if (!write_results(opts, file, results, rejects_count)) {
+        std::fprintf(stderr, "Can not write results\n");
+        return 1;
+    }
+
+    uint64_t lines = 0;
+    for (unsigned k = 0; k < opts.threads; ++k) {
+        const auto& own = stats[k];
+        const double mib = static_cast<double>(own.bytes) / (1 << 20);
+        std::fprintf(stderr, "thread %u: %llu lines, %.1f MiB in %.3f s (%.1f MiB/s, %.0f lines/s)\n", k,
+            static_cast<unsigned long long>(own.lines), mib, own.seconds,
+            own.seconds > 0 ? mib / own.seconds : 0.0, own.seconds > 0 ? own.lines / own.seconds : 0.0);
+        lines += own.lines;
+    }
+    const double total_mib = static_cast<double>(file.size()) / (1 << 20);
+    std::fprintf(stderr, "total: %llu lines, %llu rejected, %.1f MiB in %.3f s (%.1f MiB/s)\n",
+        static_cast<unsigned long long>(lines), static_cast<unsigned long long>(rejects_count), total_mib, parse_seconds,
+        parse_seconds > 0 ? total_mib / parse_seconds : 0.0);
+    return 0;
+}
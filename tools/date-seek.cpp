@@ -0,0 +1,161 @@
+//! Prints the lines of a log file sorted by time whose timestamps are in the
+//  interval [from, to). The file is mapped into memory and the boundaries of
+//  the range are found by binary search, so only O(log n) lines are parsed.
+//
+//  Usage: date-seek [options] --from TIME --to TIME <input>
+//    --format rfc3339|rfc1123   format of timestamps (default: rfc3339)
+//    --field N                  0-based field where the timestamp starts (default: 0)
+//    --delimiter C              field delimiter (default: space)
+//    --max-probe BYTES          longest run of unparsable lines (default: 64 KiB)
+//    --offsets                  print byte offsets of the range instead of lines
+//  TIME is an RFC 3339 date or seconds since the epoch.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <date-rfc/rfc-1123.h>
+#include <date-rfc/rfc-3339.h>
+#include <date-rfc/date_range_seek.h>
+#include "mapped_file.h"
+
+namespace
+{
+
+// ----------------------------------------------------------------------------
+enum class input_format
+{
+    rfc3339,
+    rfc1123,
+};
+
+struct options
+{
+    input_format format = input_format::rfc3339;
+    date::time_range_seek_options seek;
+    std::time_t from = 0;
+    std::time_t to = 0;
+    bool has_from = false;
+    bool has_to = false;
+    bool offsets = false;
+    const char* input = nullptr;
+};
+
+// ----------------------------------------------------------------------------
+bool parse_time(const char* text, std::time_t& value)
+{
+    const char* end = text + std::strlen(text);
+    char* digits_end = nullptr;
+    const long long seconds = std::strtoll(text, &digits_end, 10);
+    if (digits_end == end && digits_end != text) {
+        value = static_cast<std::time_t>(seconds);
+        return true;
+    }
+
+    const char* pos = text;
+    date::rfc3339::parts parts;
+    return date::rfc3339::read(pos, end, parts) && pos == end
+        && date::date_converter<date::rfc3339, std::time_t>::from_parts(parts, value);
+}
+
+bool parse_options(int argc, char* argv[], options& opts)
+{
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = (i + 1 < argc);
+        if (arg == "--format" && has_value) {
+            const std::string value = argv[++i];
+            if (value == "rfc3339")
+                opts.format = input_format::rfc3339;
+            else if (value == "rfc1123")
+                opts.format = input_format::rfc1123;
+            else
+                return false;
+        }
+        else if (arg == "--field" && has_value) {
+            opts.seek.field = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--delimiter" && has_value) {
+            opts.seek.delimiter = argv[++i][0];
+        }
+        else if (arg == "--max-probe" && has_value) {
+            opts.seek.max_probe = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--from" && has_value) {
+            opts.has_from = parse_time(argv[++i], opts.from);
+            if (!opts.has_from)
+                return false;
+        }
+        else if (arg == "--to" && has_value) {
+            opts.has_to = parse_time(argv[++i], opts.to);
+            if (!opts.has_to)
+                return false;
+        }
+        else if (arg == "--offsets") {
+            opts.offsets = true;
+        }
+        else if (arg.compare(0, 2, "--") == 0) {
+            return false;
+        }
+        else {
+            files.push_back(argv[i]);
+        }
+    }
+
+    if (files.size() != 1 || !opts.has_from || !opts.has_to)
+        return false;
+
+    opts.input = files[0];
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+template <class Format>
+bool seek(const options& opts, const mapped_file& file, date::time_range& range)
+{
+    const date::time_range_seeker<Format> seeker(file.data(), file.size(), opts.seek);
+    return seeker.seek(opts.from, opts.to, range);
+}
+
+} // namespace
+
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    options opts;
+    if (!parse_options(argc, argv, opts)) {
+        std::fprintf(stderr, "Usage: %s [--format rfc3339|rfc1123] [--field N] [--delimiter C] [--max-probe BYTES] [--offsets] --from TIME --to TIME <input>\n", argv[0]);
+        return 2;
+    }
+
+    mapped_file file(opts.input);
+    if (!file.is_open()) {
+        std::fprintf(stderr, "Can not map file '%s'\n", opts.input);
+        return 1;
+    }
+    file.advise_random();
+
+    date::time_range range;
+    const bool is_found = (opts.format == input_format::rfc3339)
+        ? seek<date::rfc3339>(opts, file, range)
+        : seek<date::rfc1123>(opts, file, range);
+    if (!is_found) {
+        std::fprintf(stderr, "Too long run of unparsable lines, see --max-probe\n");
+        return 1;
+    }
+
+    if (opts.offsets) {
+        std::printf("%llu %llu\n", static_cast<unsigned long long>(range.begin), static_cast<unsigned long long>(range.end));
+        std::fprintf(stderr, "%llu timestamps parsed\n", static_cast<unsigned long long>(range.parses));
+        return 0;
+    }
+
+    const std::size_t length = range.end - range.begin;
+    if (length != 0 && std::fwrite(file.data() + range.begin, 1, length, stdout) != length) {
+        std::fprintf(stderr, "Can not write results\n");
+        return 1;
+    }
+    return 0;
+}
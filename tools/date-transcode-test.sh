@@ -0,0 +1,43 @@
+#!/bin/sh
+#
+# Regression cases of date-transcode: date-transcode-test.sh <date-transcode>
+#
+set -u
+
+transcode="$1"
+work=$(mktemp -d) || exit 1
+trap 'rm -rf "$work"' EXIT
+failures=0
+
+# check <name> <expected file> <transcode arguments...> < input
+check() {
+    name="$1"
+    expected="$2"
+    shift 2
+    if ! "$transcode" "$@" > "$work/actual"; then
+        echo "FAIL: $name (exit status)"
+        failures=$((failures + 1))
+    elif ! cmp -s "$work/actual" "$expected"; then
+        echo "FAIL: $name (output)"
+        failures=$((failures + 1))
+    fi
+}
+
+# Line longer than the buffer without the final new line.
+head -c 4196 /dev/zero | tr '\0' x > "$work/long"
+check "unterminated long line" "$work/long" --buffer-size 4096 < "$work/long"
+
+# Long line with the new line followed by an unterminated long line.
+{ head -c 5000 /dev/zero | tr '\0' y; echo; cat "$work/long"; } > "$work/long2"
+check "long lines" "$work/long2" --buffer-size 4096 < "$work/long2"
+
+# Dates are written as UTC, the rest of the line is kept.
+printf '1996-12-19T16:39:57.25-08:00 y\nSun, 06 Nov 1994 08:49:37 GMT w' > "$work/dates"
+printf '1996-12-20T00:39:57.25Z y\n1994-11-06T08:49:37Z w' > "$work/dates.utc"
+check "dates" "$work/dates.utc" < "$work/dates"
+
+# Dates whose UTC year is out of 1..9999 are copied as is.
+printf '0001-01-01T00:00:00.5+01:00 x\n9999-12-31T23:30:00-01:00 z\n' > "$work/bounds"
+check "year bounds" "$work/bounds" < "$work/bounds"
+
+[ "$failures" -eq 0 ]
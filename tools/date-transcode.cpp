@@ -0,0 +1,319 @@
+//! Filter which rewrites the timestamp of every line from stdin into UTC
+//  RFC 3339 on stdout. Timestamps may be RFC 1123 or RFC 3339 with any
+//  offset; lines without a timestamp at the given place are copied as is.
+//  Input is read by large blocks into one buffer and output is collected in
+//  another one, so there is no allocation per line and no iostreams.
+//
+//  Usage: date-transcode [options] < input > output
+//    --field N              0-based field where the timestamp starts (default: 0)
+//    --delimiter C          field delimiter (default: space)
+//    --column N             0-based byte column of the timestamp, instead of --field
+//    --buffer-size BYTES    size of the input and output buffers (default: 1 MiB)
+//    --stats                print the throughput to stderr
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <date-rfc/any-date.h>
+#include <date-rfc/rfc-3339.h>
+
+namespace
+{
+
+// ----------------------------------------------------------------------------
+struct options
+{
+    std::size_t field = 0;
+    char delimiter = ' ';
+    bool use_column = false;
+    std::size_t column = 0;
+    std::size_t buffer_size = 1 << 20;
+    bool print_stats = false;
+};
+
+struct statistics
+{
+    uint64_t bytes = 0;
+    uint64_t lines = 0;
+    uint64_t transcoded = 0;
+};
+
+//! Longest growth of a line: a timestamp is replaced by at most 30 characters
+//  ('YYYY-MM-DDTHH:MM:SS.fffffffffZ') and the shortest accepted one has 16.
+enum : std::size_t { max_growth = 16 };
+
+// ----------------------------------------------------------------------------
+bool parse_options(int argc, char* argv[], options& opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = (i + 1 < argc);
+        if (arg == "--field" && has_value) {
+            opts.field = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--delimiter" && has_value) {
+            opts.delimiter = argv[++i][0];
+        }
+        else if (arg == "--column" && has_value) {
+            opts.use_column = true;
+            opts.column = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--buffer-size" && has_value) {
+            opts.buffer_size = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--stats") {
+            opts.print_stats = true;
+        }
+        else {
+            return false;
+        }
+    }
+    return (opts.buffer_size >= 4096);
+}
+
+// ----------------------------------------------------------------------------
+bool write_all(const char* data, std::size_t size)
+{
+    while (size != 0) {
+        const ssize_t written = ::write(STDOUT_FILENO, data, size);
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+//! Output buffer which is flushed by large writes.
+class output_buffer
+{
+public:
+    explicit output_buffer(std::size_t capacity) : m_data(capacity), m_size(0) {}
+
+    //! Makes room for the given count of characters.
+    bool reserve(std::size_t count)
+    {
+        if (m_size + count <= m_data.size())
+            return true;
+        if (!flush())
+            return false;
+        if (count > m_data.size())
+            m_data.resize(count);
+        return true;
+    }
+
+    char* end()
+    {
+        return m_data.data() + m_size;
+    }
+
+    void commit(char* end)
+    {
+        m_size = static_cast<std::size_t>(end - m_data.data());
+    }
+
+    //! Appends characters which were reserved before.
+    void append(const char* data, std::size_t size)
+    {
+        assert(m_size + size <= m_data.size());
+        std::memcpy(end(), data, size);
+        m_size += size;
+    }
+
+    bool flush()
+    {
+        const bool is_ok = write_all(m_data.data(), m_size);
+        m_size = 0;
+        return is_ok;
+    }
+
+private:
+    std::vector<char> m_data;
+    std::size_t m_size;
+};
+
+// ----------------------------------------------------------------------------
+const char* timestamp_start(const options& opts, const char* pos, const char* end)
+{
+    if (opts.use_column)
+        return (static_cast<std::size_t>(end - pos) > opts.column) ? pos + opts.column : nullptr;
+
+    for (std::size_t i = 0; i < opts.field; ++i) {
+        const void* delimiter = std::memchr(pos, opts.delimiter, static_cast<std::size_t>(end - pos));
+        if (delimiter == nullptr)
+            return nullptr;
+        pos = static_cast<const char*>(delimiter) + 1;
+    }
+    return pos;
+}
+
+// ----------------------------------------------------------------------------
+//! Writes the date as UTC RFC 3339, the fraction of the second is kept
+//  without trailing zeros. Nothing is written for dates whose UTC year is
+//  out of 1..9999.
+bool write_utc(std::time_t timepoint, uint32_t nanosecond, char*& dst)
+{
+    date::rfc3339::parts parts;
+    if (!date::date_converter<date::rfc3339, std::time_t>::to_parts(timepoint, parts) || parts.year < 1 || parts.year > 9999)
+        return false;
+    if (!date::rfc3339::write(parts, dst))
+        return false;
+    if (nanosecond == 0)
+        return true;
+
+    --dst;
+    *(dst++) = '.';
+    char digits[9];
+    int count = 9;
+    for (int i = 8; i >= 0; --i, nanosecond /= 10)
+        digits[i] = static_cast<char>('0' + nanosecond % 10);
+    while (digits[count - 1] == '0')
+        --count;
+    std::memcpy(dst, digits, static_cast<std::size_t>(count));
+    dst += count;
+    *(dst++) = 'Z';
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+//! Writes the line into the output, the line ends with the new line character
+//  if it is not the last one.
+bool transcode_line(const options& opts, const char* line, const char* end, output_buffer& output, statistics& stats)
+{
+    if (!output.reserve(static_cast<std::size_t>(end - line) + max_growth))
+        return false;
+
+    const char* start = timestamp_start(opts, line, end);
+    if (start != nullptr) {
+        while (start != end && *start == ' ')
+            ++start;
+
+        const char* pos = start;
+        date::any_date::parts parts;
+        std::time_t timepoint = 0;
+        if (date::any_date::read(pos, end, parts) && parts.format != date::any_date::epoch_format
+            && date::date_converter<date::any_date, std::time_t>::from_parts(parts, timepoint)) {
+            const uint32_t nanosecond = (parts.format == date::any_date::rfc3339_format) ? parts.rfc3339_value.nanosecond : 0;
+            char* const mark = output.end();
+            output.append(line, static_cast<std::size_t>(start - line));
+            char* dst = output.end();
+            if (write_utc(timepoint, nanosecond, dst)) {
+                output.commit(dst);
+                output.append(pos, static_cast<std::size_t>(end - pos));
+                ++stats.transcoded;
+                return true;
+            }
+            output.commit(mark);
+        }
+    }
+
+    output.append(line, static_cast<std::size_t>(end - line));
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+bool run(const options& opts, statistics& stats)
+{
+    std::vector<char> input(opts.buffer_size);
+    output_buffer output(opts.buffer_size);
+    std::size_t used = 0;
+    bool is_long_line = false;
+
+    for (;;) {
+        const ssize_t count = ::read(STDIN_FILENO, input.data() + used, input.size() - used);
+        if (count < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        stats.bytes += static_cast<uint64_t>(count);
+
+        const char* pos = input.data();
+        const char* end = input.data() + used + count;
+        if (count == 0) {
+            if (pos != end) {
+                ++stats.lines;
+                if (is_long_line) {
+                    if (!output.reserve(static_cast<std::size_t>(end - pos)))
+                        return false;
+                    output.append(pos, static_cast<std::size_t>(end - pos));
+                }
+                else if (!transcode_line(opts, pos, end, output, stats)) {
+                    return false;
+                }
+            }
+            return output.flush();
+        }
+
+        for (;;) {
+            const void* eol = std::memchr(pos, '\n', static_cast<std::size_t>(end - pos));
+            if (eol == nullptr)
+                break;
+
+            const char* line_end = static_cast<const char*>(eol) + 1;
+            if (is_long_line) {
+                //! Tail of a line longer than the buffer is copied as is.
+                if (!output.reserve(static_cast<std::size_t>(line_end - pos)))
+                    return false;
+                output.append(pos, static_cast<std::size_t>(line_end - pos));
+                is_long_line = false;
+            }
+            else if (!transcode_line(opts, pos, line_end, output, stats)) {
+                return false;
+            }
+            ++stats.lines;
+            pos = line_end;
+        }
+
+        used = static_cast<std::size_t>(end - pos);
+        if (used == input.size()) {
+            if (!output.reserve(used))
+                return false;
+            output.append(pos, used);
+            is_long_line = true;
+            used = 0;
+        }
+        else if (used != 0) {
+            std::memmove(input.data(), pos, used);
+        }
+    }
+}
+
+} // namespace
+
+// ----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    options opts;
+    if (!parse_options(argc, argv, opts)) {
+        std::fprintf(stderr, "Usage: %s [--field N] [--delimiter C] [--column N] [--buffer-size BYTES] [--stats] < input > output\n", argv[0]);
+        return 2;
+    }
+
+    statistics stats;
+    const auto started = std::chrono::steady_clock::now();
+    if (!run(opts, stats)) {
+        std::fprintf(stderr, "I/O error: %s\n", std::strerror(errno));
+        return 1;
+    }
+
+    if (opts.print_stats) {
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        const double mib = static_cast<double>(stats.bytes) / (1 << 20);
+        std::fprintf(stderr, "%llu lines, %llu transcoded, %.1f MiB in %.3f s (%.1f MiB/s, %.0f lines/s)\n",
+            static_cast<unsigned long long>(stats.lines), static_cast<unsigned long long>(stats.transcoded), mib, seconds,
+            seconds > 0 ? mib / seconds : 0.0, seconds > 0 ? stats.lines / seconds : 0.0);
+    }
+    return 0;
+}
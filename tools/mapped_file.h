@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ----------------------------------------------------------------------------
+//! Read-only memory mapping of a whole file.
+class mapped_file
+{
+public:
+    explicit mapped_file(const char* path)
+    {
+        m_fd = ::open(path, O_RDONLY);
+        if (m_fd < 0)
+            return;
+
+        struct stat info{};
+        if (::fstat(m_fd, &info) != 0)
+            return;
+
+        m_size = static_cast<std::size_t>(info.st_size);
+        if (m_size == 0)
+        {
+            m_isOpen = true;
+            return;
+        }
+
+        void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+        if (data == MAP_FAILED)
+            return;
+
+        ::madvise(data, m_size, MADV_SEQUENTIAL);
+        m_data = static_cast<const char*>(data);
+        m_isOpen = true;
+    }
+
+    ~mapped_file()
+    {
+        if (m_data != nullptr)
+            ::munmap(const_cast<char*>(m_data), m_size);
+        if (m_fd >= 0)
+            ::close(m_fd);
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    bool is_open() const
+    {
+        return m_isOpen;
+    }
+
+    const char* data() const
+    {
+        return m_data;
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    //! Hint for random access (e.g. binary search) instead of a sequential scan.
+    void advise_random() const
+    {
+        if (m_data != nullptr)
+            ::madvise(const_cast<char*>(m_data), m_size, MADV_RANDOM);
+    }
+
+private:
+    int m_fd = -1;
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_isOpen = false;
+};